@@ -1,32 +1,206 @@
+import argparse
+import os
+import re
+import sys
+
+import numpy as np
 from PIL import Image
 
+IMAGE_EXTENSIONS = (".png", ".bmp", ".jpg", ".jpeg", ".gif", ".tif", ".tiff", ".webp")
+
+# 4x4 Bayer matrix, normalized to thresholds in the range [0, 255].
+BAYER_4X4 = (np.array([[0, 8, 2, 10], [12, 4, 14, 6], [3, 11, 1, 9], [15, 7, 13, 5]], dtype=np.float32) + 0.5) * (256 / 16)
 
-def print_array(py_array):
+
+def print_array(py_array, file=None):
     """
     Prints a 2D byte array as a monochrome image, simulating the OLED display.
 
-    @param py_array: List[List[int]]
+    @param py_array: List[List[int]] | numpy.ndarray
         A 2D list of byte blocks representing the monochrome image.
+    @param file: file object, optional
+        Stream to print to. Defaults to stdout.
 
     @return: None
     """
-    for array in py_array:
-        segment = ["" for _ in range(8)]
+    pages = np.asarray(py_array, dtype=np.uint8)
+    if pages.ndim != 2 or pages.size == 0:
+        return
+
+    bits = unpack_pages(pages)
+    lines = np.where(bits, "█", " ")
+    print("\n".join("".join(line) for line in lines), file=file)
+
+
+def otsu_threshold(pixels):
+    """
+    Calculates the Otsu binarization threshold of a grayscale image.
+
+    @param pixels: numpy.ndarray
+        2D uint8 array of grayscale pixels.
+
+    @return: int
+        Threshold from 0 to 255.
+    """
+    histogram = np.bincount(pixels.ravel(), minlength=256).astype(np.float64)
+    levels = np.arange(256, dtype=np.float64)
+
+    w_b = np.cumsum(histogram)
+    w_f = w_b[-1] - w_b
+    sum_b = np.cumsum(histogram * levels)
+    sum_total = sum_b[-1]
+
+    with np.errstate(divide="ignore", invalid="ignore"):
+        m_b = sum_b / w_b
+        m_f = (sum_total - sum_b) / w_f
+        variance_between = w_b * w_f * (m_b - m_f) ** 2
+    variance_between[~np.isfinite(variance_between)] = 0
+
+    return int(np.argmax(variance_between))
+
+
+def binarize(image, dither="none", threshold=None):
+    """
+    Converts a grayscale image to a boolean pixel matrix where True is a lit pixel.
+
+    @param image: PIL.Image.Image
+        Grayscale ("L") image.
+    @param dither: str, optional
+        "none" for Otsu/threshold binarization, "floyd-steinberg" for error diffusion or "ordered" for 4x4 Bayer. Defaults to "none".
+    @param threshold: int, optional
+        Threshold for binarization, from 0 to 255. If None, it is calculated automatically.
+
+    @return: numpy.ndarray
+        2D bool array of shape (height, width).
+    """
+    if dither == "floyd-steinberg":
+        # Pillow implements Floyd-Steinberg natively in C, which is orders of magnitude faster than diffusing in Python.
+        return np.asarray(image.convert("1", dither=Image.Dither.FLOYDSTEINBERG), dtype=bool)
+
+    pixels = np.asarray(image, dtype=np.uint8)
+    if dither == "ordered":
+        height, width = pixels.shape
+        tiles = np.tile(BAYER_4X4, ((height + 3) // 4, (width + 3) // 4))[:height, :width]
+        return pixels > tiles
+
+    if threshold is None:
+        threshold = otsu_threshold(pixels)
+    return pixels > threshold
+
+
+def pack_pages(bits):
+    """
+    Packs a boolean pixel matrix into the page/segment layout of the SSD1306 buffer.
+
+    Each output byte is a vertical strip of 8 pixels, bit 0 being the top pixel of the page.
+
+    @param bits: numpy.ndarray
+        2D bool array of shape (height, width).
+
+    @return: numpy.ndarray
+        2D uint8 array of shape (ceil(height / 8), width).
+    """
+    height, width = bits.shape
+    pages = (height + 7) // 8
+    padded = np.zeros((pages * 8, width), dtype=bool)
+    padded[:height] = bits
+    return np.packbits(padded.reshape(pages, 8, width), axis=1, bitorder="little").reshape(pages, width)
+
+
+def unpack_pages(pages):
+    """
+    Unpacks the page/segment layout of the SSD1306 buffer into a boolean pixel matrix.
+
+    @param pages: numpy.ndarray
+        2D uint8 array of shape (pages, width).
+
+    @return: numpy.ndarray
+        2D bool array of shape (pages * 8, width).
+    """
+    total_pages, width = pages.shape
+    bits = np.unpackbits(pages.reshape(total_pages, 1, width), axis=1, bitorder="little")
+    return bits.reshape(total_pages * 8, width).astype(bool)
+
+
+def rle_encode(data):
+    """
+    Compresses bytes with the PackBits-style scheme decoded by i2c_ssd1306_buffer_image_rle().
+
+    A control byte with bit 7 set is followed by one byte repeated (control & 0x7F) + 1 times.
+    A control byte with bit 7 clear is followed by control + 1 literal bytes.
+
+    @param data: bytes | numpy.ndarray
+        Raw bytes to compress.
+
+    @return: bytes
+        Compressed stream.
+    """
+    data = np.asarray(data, dtype=np.uint8).ravel()
+    if data.size == 0:
+        return b""
+
+    # Vectorized run detection: boundaries where the value changes.
+    starts = np.flatnonzero(np.concatenate(([True], data[1:] != data[:-1])))
+    lengths = np.diff(np.append(starts, data.size))
+
+    out = bytearray()
+    literal = bytearray()
+
+    def flush_literal():
+        for i in range(0, len(literal), 128):
+            chunk = literal[i : i + 128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+        literal.clear()
+
+    for start, length in zip(starts.tolist(), lengths.tolist()):
+        value = int(data[start])
+        if length < 3:
+            literal.extend([value] * length)
+            continue
+        flush_literal()
+        while length > 0:
+            run = min(length, 128)
+            out.append(0x80 | (run - 1))
+            out.append(value)
+            length -= run
+    flush_literal()
+
+    return bytes(out)
+
+
+def rle_decode(data, size):
+    """
+    Decompresses a stream produced by rle_encode().
 
-        for byte in array:
-            bin = format(byte, "08b")
-            for i in range(8):
-                segment[7 - i] += "█" if bin[i] == "1" else " "
+    @param data: bytes
+        Compressed stream.
+    @param size: int
+        Number of bytes to produce.
 
-        for linea in segment:
-            print(linea)
+    @return: numpy.ndarray
+        1D uint8 array of decompressed bytes.
+    """
+    out = bytearray()
+    i = 0
+    while len(out) < size and i < len(data):
+        control = data[i]
+        if control & 0x80:
+            out.extend([data[i + 1]] * ((control & 0x7F) + 1))
+            i += 2
+        else:
+            out.extend(data[i + 1 : i + 2 + control])
+            i += control + 2
+    if len(out) != size:
+        raise ValueError(f"RLE stream decodes to {len(out)} bytes, expected {size}")
+    return np.frombuffer(bytes(out), dtype=np.uint8)
 
 
 def format_as_c_array(py_array, c_array_name="img", line_break=16):
     """
     Formats a 2D byte array as a C array string.
 
-    @param py_array: List[List[int]]
+    @param py_array: List[List[int]] | numpy.ndarray
         A 2D list of byte blocks representing the monochrome image.
     @param c_array_name: str, optional
         Name of the C array. Defaults to "img".
@@ -36,11 +210,11 @@ def format_as_c_array(py_array, c_array_name="img", line_break=16):
     @return: str
         A string representing the C array.
     """
-    rows = len(py_array)
-    cols = len(py_array[0]) if rows > 0 else 0
+    py_array = np.asarray(py_array, dtype=np.uint8)
+    rows, cols = py_array.shape
 
-    c_array = f"uint8_t {c_array_name}[{rows}][{cols}] = {{\n"
-    for row in byte_array:
+    c_array = f"const uint8_t {c_array_name}[{rows}][{cols}] = {{\n"
+    for row in py_array:
         c_array += "    {"
         for i in range(0, len(row), line_break):
             chunk = row[i : i + line_break]
@@ -52,10 +226,81 @@ def format_as_c_array(py_array, c_array_name="img", line_break=16):
     return c_array
 
 
-def image_to_byte_array(image_path, width, height, invert=False, threshold=None):
+def format_as_c_rle(data, c_array_name="img", line_break=16):
+    """
+    Formats an RLE stream as a flat C array string.
+
+    @param data: bytes
+        Compressed stream.
+    @param c_array_name: str, optional
+        Name of the C array. Defaults to "img".
+    @param line_break: int, optional
+        Number of bytes per line. Defaults to 16.
+
+    @return: str
+        A string representing the C array.
+    """
+    lines = []
+    for i in range(0, len(data), line_break):
+        lines.append("    " + ", ".join(f"0x{byte:02X}" for byte in data[i : i + line_break]))
+    return f"const uint8_t {c_array_name}[{len(data)}] = {{\n" + ",\n".join(lines) + "\n};"
+
+
+def parse_c_array(source, c_array_name):
+    """
+    Reads back the bytes of an array written by format_as_c_array() or format_as_c_rle().
+
+    @param source: str
+        C source containing the array.
+    @param c_array_name: str
+        Name of the array to read.
+
+    @return: numpy.ndarray
+        uint8 array shaped by the dimensions declared in the source.
+    """
+    match = re.search(rf"const uint8_t {re.escape(c_array_name)}((?:\[\d+\])+) = \{{(.*?)\n\}};", source, re.DOTALL)
+    if match is None:
+        raise ValueError(f"array {c_array_name} not found in the output")
+
+    shape = tuple(int(size) for size in re.findall(r"\d+", match.group(1)))
+    data = np.array([int(byte, 16) for byte in re.findall(r"0x([0-9A-F]{2})", match.group(2))], dtype=np.uint8)
+    if data.size != np.prod(shape):
+        raise ValueError(f"array {c_array_name} declares {np.prod(shape)} bytes but holds {data.size}")
+    return data.reshape(shape)
+
+
+def load_grayscale(image_path, width=None, height=None):
+    """
+    Opens an image, flattens transparency onto white and converts it to grayscale.
+
+    @param image_path: str
+        Path to the image file.
+    @param width: int, optional
+        Output width. Defaults to the source width.
+    @param height: int, optional
+        Output height. Defaults to the source height.
+
+    @return: PIL.Image.Image
+        Grayscale ("L") image.
+    """
+    image = Image.open(image_path)
+    if image.mode in ("RGBA", "LA", "P"):
+        image = image.convert("RGBA")
+        background = Image.new("RGBA", image.size, (255, 255, 255, 255))
+        image = Image.alpha_composite(background, image)
+    image = image.convert("L")
+
+    if width is not None or height is not None:
+        image = image.resize((width or image.width, height or image.height))
+    return image
+
+
+def image_to_byte_array(image_path, width, height, invert=False, threshold=None, dither="none"):
     """
     Converts an image to a byte array representation for use in monochrome displays.
 
+    Dark source pixels become lit OLED pixels, as in the original tool; use invert for the opposite.
+
     @param image_path: str
         Path to the image file.
     @param width: int
@@ -66,67 +311,214 @@ def image_to_byte_array(image_path, width, height, invert=False, threshold=None)
         Whether to invert the colors in the output. Defaults to False.
     @param threshold: int, optional
         Threshold for binarization, from 0 to 255. If None, it is calculated automatically.
+    @param dither: str, optional
+        "none", "floyd-steinberg" or "ordered". Defaults to "none".
 
-    @return: List[List[int]]
-        A 2D list of byte blocks representing the monochrome image.
+    @return: numpy.ndarray
+        A 2D uint8 array of byte blocks representing the monochrome image.
+    """
+    image = load_grayscale(image_path, width, height)
+    lit = ~binarize(image, dither, threshold)
+    if invert:
+        lit = ~lit
+    return pack_pages(lit)
+
+
+def image_to_font(image_path, invert=False, threshold=None, glyph_width=8, glyph_height=8):
     """
-    image = Image.open(image_path).convert("L")
-    image = image.resize((width, height))
+    Slices a glyph sheet into 8x8 glyphs in the font8x8 layout of the driver.
 
-    if threshold is None:
-        histogram = image.histogram()
-        total_pixels = sum(histogram)
-        sum_brightness = sum(i * histogram[i] for i in range(256))
-        sum_b = 0
-        max_variance = 0
-        threshold = 0
-        w_b = 0
-
-        for t in range(256):
-            w_b += histogram[t]
-            w_f = total_pixels - w_b
-            if w_b == 0 or w_f == 0:
-                continue
-
-            sum_b += t * histogram[t]
-            m_b = sum_b / w_b
-            m_f = (sum_brightness - sum_b) / w_f
-            variance_between = w_b * w_f * (m_b - m_f) ** 2
-
-            if variance_between > max_variance:
-                max_variance = variance_between
-                threshold = t
-
-    print(f"Threshold: {threshold}")
-
-    image = image.point(lambda p: 255 if p > threshold else 0, mode="1")
+    Glyphs are read left to right, top to bottom. Each glyph becomes 8 column bytes, bit 0 being the top pixel.
+
+    @param image_path: str
+        Path to the glyph sheet.
+    @param invert: bool, optional
+        Whether to invert the colors in the output. Defaults to False.
+    @param threshold: int, optional
+        Threshold for binarization, from 0 to 255. If None, it is calculated automatically.
+    @param glyph_width: int, optional
+        Width of a glyph cell in the sheet. Defaults to 8.
+    @param glyph_height: int, optional
+        Height of a glyph cell in the sheet, at most 8. Defaults to 8.
+
+    @return: numpy.ndarray
+        A 2D uint8 array of shape (glyphs, glyph_width).
+    """
+    if glyph_height > 8:
+        raise ValueError("Glyph height must be at most 8 pixels")
+
+    image = load_grayscale(image_path)
+    lit = ~binarize(image, "none", threshold)
     if invert:
-        image = image.point(lambda p: 255 if p == 0 else 0, mode="1")
-    image.show()
+        lit = ~lit
+
+    rows, cols = image.height // glyph_height, image.width // glyph_width
+    cells = lit[: rows * glyph_height, : cols * glyph_width]
+    cells = cells.reshape(rows, glyph_height, cols, glyph_width).transpose(0, 2, 1, 3).reshape(rows * cols, glyph_height, glyph_width)
+
+    padded = np.zeros((rows * cols, 8, glyph_width), dtype=bool)
+    padded[:, :glyph_height] = cells
+    return np.packbits(padded, axis=1, bitorder="little").reshape(rows * cols, glyph_width)
+
+
+def collect_inputs(paths):
+    """
+    Expands files and directories into a sorted list of image files.
+
+    @param paths: List[str]
+        Files or directories.
+
+    @return: List[str]
+        Image file paths.
+    """
+    files = []
+    for path in paths:
+        if os.path.isdir(path):
+            entries = sorted(os.listdir(path))
+            files.extend(os.path.join(path, entry) for entry in entries if entry.lower().endswith(IMAGE_EXTENSIONS))
+        else:
+            files.append(path)
+    return files
+
+
+def c_identifier(text):
+    """
+    Turns an arbitrary string into a valid C identifier.
+
+    @param text: str
+        Source text, typically a file stem.
+
+    @return: str
+        C identifier.
+    """
+    identifier = re.sub(r"\W", "_", text)
+    if not identifier or identifier[0].isdigit():
+        identifier = "_" + identifier
+    return identifier
+
+
+def print_font(glyphs, first_char, file=None):
+    """
+    Prints each glyph of a font through print_array().
+
+    @param glyphs: numpy.ndarray
+        2D uint8 array of shape (glyphs, glyph_width).
+    @param first_char: int
+        Character code of the first glyph.
+    @param file: file object, optional
+        Stream to print to. Defaults to stdout.
+
+    @return: None
+    """
+    for i, glyph in enumerate(glyphs):
+        print(f"--- {first_char + i} (0x{first_char + i:02X}) ---", file=file)
+        print_array(glyph.reshape(1, -1), file)
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Convert images to C arrays in the SSD1306 driver page/segment layout.")
+    parser.add_argument("inputs", nargs="+", help="Image files or directories of images (processed in name order).")
+    parser.add_argument("-W", "--width", type=int, help="Output width in pixels, maximum 128 for SSD1306.")
+    parser.add_argument("-H", "--height", type=int, help="Output height in pixels, maximum 64 for SSD1306.")
+    parser.add_argument("-f", "--format", choices=("image", "font"), default="image", help="Output layout. Defaults to image.")
+    parser.add_argument("-d", "--dither", choices=("none", "floyd-steinberg", "ordered"), default="none", help="Binarization method for images. Defaults to none (Otsu threshold).")
+    parser.add_argument("-t", "--threshold", type=int, help="Binarization threshold from 0 to 255. Automatic if omitted.")
+    parser.add_argument("-i", "--invert", action="store_true", help="Invert the output colors.")
+    parser.add_argument("-c", "--compress", action="store_true", help="Emit RLE streams for i2c_ssd1306_buffer_image_rle() instead of raw arrays.")
+    parser.add_argument("-n", "--name", default="img", help="C array name, or prefix of the array names in batch mode. Defaults to img.")
+    parser.add_argument("--first-char", type=int, default=32, help="Character code of the first glyph in font mode. Defaults to 32.")
+    parser.add_argument("-o", "--output", help="Write the C source to this file instead of stdout.")
+    parser.add_argument("-v", "--verify", action="store_true", help="Decode the written arrays back and render them through print_array on stderr.")
+    parser.add_argument("--preview", action="store_true", help="Open each processed image in the system viewer.")
+    args = parser.parse_args(argv)
+
+    if args.compress and args.format == "font":
+        parser.error("-c/--compress only applies to -f image, fonts are indexed by glyph and cannot be RLE streams")
+
+    files = collect_inputs(args.inputs)
+    if not files:
+        parser.error("no input images found")
+
+    chunks = []
+    frame_names = []
+    frame_shape = None
+    verified = []
+    raw_bytes = 0
+    out_bytes = 0
+
+    for path in files:
+        stem = os.path.splitext(os.path.basename(path))[0]
+        name = c_identifier(args.name if len(files) == 1 else f"{args.name}_{stem}")
+
+        if args.format == "font":
+            glyphs = image_to_font(path, args.invert, args.threshold)
+            chunks.append(f"/* {path}: {len(glyphs)} glyphs from {args.first_char} (0x{args.first_char:02X}) */\n" + format_as_c_array(glyphs, name))
+            raw_bytes += glyphs.size
+            out_bytes += glyphs.size
+            if args.verify:
+                verified.append((name, glyphs, None))
+            continue
+
+        pages = image_to_byte_array(path, args.width, args.height, args.invert, args.threshold, args.dither)
+        total_pages, width = pages.shape
+        if len(files) > 1 and frame_shape is not None and pages.shape != frame_shape:
+            # The frame table shares one geometry, so every frame must have the size of the first one.
+            print(f"{path}: frame is {width}x{total_pages * 8}, the previous frames are {frame_shape[1]}x{frame_shape[0] * 8}; set -W and -H", file=sys.stderr)
+            return 1
+        frame_shape = pages.shape
+        raw_bytes += pages.size
+        header = f"/* {path}: {width}x{total_pages * 8}, {total_pages} pages */\n"
+
+        if args.compress:
+            stream = rle_encode(pages)
+            chunks.append(header + format_as_c_rle(stream, name))
+            out_bytes += len(stream)
+        else:
+            chunks.append(header + format_as_c_array(pages, name))
+            out_bytes += pages.size
+        if args.verify:
+            verified.append((name, pages, path))
 
-    pixels = list(image.getdata())
+        frame_names.append(name)
+        if args.preview:
+            Image.fromarray(np.where(unpack_pages(pages), 255, 0).astype(np.uint8)).show()
 
-    rows = [pixels[i * width : (i + 1) * width] for i in range(height)]
+    if len(frame_names) > 1:
+        entries = ",\n".join(f"    (const uint8_t *){frame}" for frame in frame_names)
+        chunks.append(f"const uint8_t *const {c_identifier(args.name)}_frames[{len(frame_names)}] = {{\n{entries}\n}};")
+        if args.compress:
+            # RLE streams differ in length, and i2c_ssd1306_buffer_image_rle() needs the size of each one.
+            sizes = ",\n".join(f"    sizeof({frame})" for frame in frame_names)
+            chunks.append(f"const size_t {c_identifier(args.name)}_frame_sizes[{len(frame_names)}] = {{\n{sizes}\n}};")
 
-    byte_blocks = []
-    for group_start in range(0, height, 8):
-        group = rows[group_start : group_start + 8]
-        block = []
-        for col in range(width):
-            byte = 0
-            for row_idx, row in enumerate(group):
-                if row[col] == 0:
-                    byte |= 1 << row_idx
-            block.append(byte)
-        byte_blocks.append(block)
+    source = "\n\n".join(chunks) + "\n"
 
-    return byte_blocks
+    # Verification reads the arrays back from the written source, and prints on stderr so stdout stays valid C.
+    for name, expected, path in verified:
+        written = parse_c_array(source, name)
+        if args.compress:
+            decoded = rle_decode(written.tobytes(), expected.size).reshape(expected.shape)
+            label = f"{name} ({written.size}/{expected.size} bytes)"
+        else:
+            decoded = written
+            label = name
+        if not np.array_equal(decoded, expected):
+            print(f"{path or name}: written array does not decode to the converted image", file=sys.stderr)
+            return 1
+        if path is None:
+            print_font(decoded, args.first_char, sys.stderr)
+        else:
+            print(f"--- {label} ---", file=sys.stderr)
+            print_array(decoded, sys.stderr)
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as file:
+            file.write(source)
+    else:
+        sys.stdout.write(source)
 
+    print(f"{len(files)} input(s), {raw_bytes} raw bytes, {out_bytes} output bytes", file=sys.stderr)
+    return 0
 
-image_path = r"C:\Path\to\your\image.png"
-width, height = 64, 64
 
-byte_array = image_to_byte_array(image_path, width, height, True)
-c_array = format_as_c_array(byte_array)
-print_array(byte_array)
-print(c_array)
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "ssd1306_driver.h"
+
+#define SSD1306_COMPOSITOR_TAG "SSD1306 Compositor"
+
+#define SSD1306_COMPOSITOR_MAX_SPRITES 8 // Maximum number of sprites, drawn in index order so higher indexes are on top.
+
+/**
+ * @brief SSD1306 sprite type
+ *
+ * This structure stores a sprite of the compositor. Images and masks use the page layout of i2c_ssd1306_buffer_image(), one
+ * byte per column and page of the sprite.
+ *
+ * - image: Pixels of the sprite.
+ * - mask: Pixels of the sprite that cover the layers below, NULL to cover its whole bounding box.
+ * - width: Width of the sprite.
+ * - height: Height of the sprite.
+ * - x: X coordinate of the sprite, may be partly outside of the display.
+ * - y: Y coordinate of the sprite, may be partly outside of the display.
+ * - visible: Draw the sprite if true.
+ * - invert: Invert the pixels of the sprite if true.
+ * - dirty: The sprite changed since the last flush.
+ * - drawn: The sprite is on the display, at drawn_x and drawn_y.
+ */
+typedef struct
+{
+    const uint8_t *image;
+    const uint8_t *mask;
+    uint8_t width;
+    uint8_t height;
+    int16_t x;
+    int16_t y;
+    bool visible;
+    bool invert;
+    bool dirty;
+    bool drawn;
+    int16_t drawn_x;
+    int16_t drawn_y;
+} ssd1306_sprite_t;
+
+/**
+ * @brief I2C SSD1306 compositor handle type
+ *
+ * This structure stores the background of the display and its sprites.
+ */
+typedef struct
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306;
+    uint8_t width;
+    uint8_t total_pages;
+    uint8_t *background;
+    ssd1306_sprite_t sprite[SSD1306_COMPOSITOR_MAX_SPRITES];
+    uint8_t total_sprites;
+    bool background_dirty;
+} i2c_ssd1306_compositor_handle_t;
+
+esp_err_t i2c_ssd1306_compositor_init(i2c_ssd1306_compositor_handle_t *compositor, i2c_ssd1306_handle_t *i2c_ssd1306);
+void i2c_ssd1306_compositor_deinit(i2c_ssd1306_compositor_handle_t *compositor);
+void i2c_ssd1306_compositor_set_background(i2c_ssd1306_compositor_handle_t *compositor);
+esp_err_t i2c_ssd1306_compositor_add_sprite(i2c_ssd1306_compositor_handle_t *compositor, const uint8_t *image, const uint8_t *mask, uint8_t width, uint8_t height, int16_t x, int16_t y, uint8_t *sprite_id);
+void i2c_ssd1306_compositor_move_sprite(i2c_ssd1306_compositor_handle_t *compositor, uint8_t sprite_id, int16_t x, int16_t y);
+void i2c_ssd1306_compositor_show_sprite(i2c_ssd1306_compositor_handle_t *compositor, uint8_t sprite_id, bool visible);
+void i2c_ssd1306_compositor_set_sprite_image(i2c_ssd1306_compositor_handle_t *compositor, uint8_t sprite_id, const uint8_t *image, const uint8_t *mask, bool invert);
+uint16_t i2c_ssd1306_compositor_flush(i2c_ssd1306_compositor_handle_t *compositor);
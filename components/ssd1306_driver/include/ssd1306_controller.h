@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SSD1306_CONTROLLER_MAX_INIT_CMD 48 // Maximum number of bytes of an initialization sequence, remap included.
+
+/**
+ * @brief SSD1306 controller addressing type
+ *
+ * This enumeration defines how the RAM of a controller is written.
+ *
+ * - SSD1306_ADDRESSING_PAGE: Only page addressing, every page is addressed separately.
+ * - SSD1306_ADDRESSING_HORIZONTAL: Page addressing for spans, and a column and page window for whole frames, so a frame is
+ *   sent in a single write.
+ * - SSD1306_ADDRESSING_GRAY4: Column and row windows over a RAM of 4 bits per pixel. The buffer is expanded while it is sent
+ *   and spans are widened to whole bytes of two pixels.
+ */
+typedef enum
+{
+    SSD1306_ADDRESSING_PAGE,
+    SSD1306_ADDRESSING_HORIZONTAL,
+    SSD1306_ADDRESSING_GRAY4
+} ssd1306_addressing_t;
+
+/**
+ * @brief SSD1306 controller descriptor type
+ *
+ * This structure describes a controller of the SSD13xx family. Drawing always goes through the common buffer, the descriptor
+ * only changes how the device is initialized and how the buffer reaches its RAM.
+ *
+ * - name: Name of the controller.
+ * - max_width: Maximum width of the display.
+ * - max_height: Maximum height of the display.
+ * - column_offset: RAM column of the first displayed column.
+ * - max_transfer: Maximum number of RAM bytes sent in one write.
+ * - addressing: Fastest addressing the controller supports.
+ * - init_cmd: Writes the initialization sequence without the remap and the display on command, returns its size.
+ * - remap_cmd: Writes the commands that flip the segments and the COM scan direction, returns their size.
+ */
+typedef struct
+{
+    const char *name;
+    uint8_t max_width;
+    uint8_t max_height;
+    uint8_t column_offset;
+    uint16_t max_transfer;
+    ssd1306_addressing_t addressing;
+    uint8_t (*init_cmd)(uint8_t *cmd, uint8_t height);
+    uint8_t (*remap_cmd)(uint8_t *cmd, bool flip_segment, bool flip_com);
+} ssd1306_controller_t;
+
+extern const ssd1306_controller_t ssd1306_controller_ssd1306;
+extern const ssd1306_controller_t ssd1306_controller_ssd1309;
+extern const ssd1306_controller_t ssd1306_controller_sh1106;
+extern const ssd1306_controller_t ssd1306_controller_ssd1327;
@@ -1,14 +1,22 @@
 #pragma once
 
-#include <driver/i2c_master.h>
+#include "ssd1306_transport.h"
+#include "ssd1306_controller.h"
+#include "ssd1306_profile.h"
 #include "esp_err.h"
 #include "esp_log.h"
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+
+#ifdef ESP_PLATFORM
 #include "freertos/FreeRTOS.h"
+#endif
 
 #define SSD1306_TAG "SSD1306 Driver"
 
-#define I2C_MASTER_TIMEOUT_MS 1000
+#define SSD1306_QUEUE_MAX_SPANS 8 // Maximum number of separate spans queued per page.
+#define SSD1306_QUEUE_MERGE_GAP 8 // Maximum number of unchanged segments resent to merge two spans into one transmission.
 
 /**
  * @brief SSD1306 display wise type
@@ -21,6 +29,20 @@ typedef enum
     SSD1306_BOTTOM_TO_TOP
 } ssd1306_wise_t;
 
+/**
+ * @brief SSD1306 display rotation type
+ *
+ * This enumeration defines the clockwise rotation of the SSD1306 display relative to its wise. 90 and 270 degrees swap the
+ * width and height of the buffer.
+ */
+typedef enum
+{
+    SSD1306_ROTATION_0,
+    SSD1306_ROTATION_90,
+    SSD1306_ROTATION_180,
+    SSD1306_ROTATION_270
+} ssd1306_rotation_t;
+
 /**
  * @brief SSD1306 page type
  *
@@ -32,25 +54,69 @@ typedef struct
     uint8_t *segment;
 } ssd1306_page_t;
 
+/**
+ * @brief SSD1306 queued span type
+ *
+ * This structure stores a range of segments of a page waiting to be transferred to the RAM.
+ */
+
+typedef struct
+{
+    uint8_t initial_segment;
+    uint8_t final_segment;
+} ssd1306_span_t;
+
+/**
+ * @brief SSD1306 page queue type
+ *
+ * This structure stores the sorted, merged spans of a page waiting to be transferred to the RAM. One extra entry holds a new
+ * span until it is merged.
+ */
+
+typedef struct
+{
+    uint8_t count;
+    ssd1306_span_t span[SSD1306_QUEUE_MAX_SPANS + 1];
+} ssd1306_queue_page_t;
+
 /**
  * @brief I2C SSD1306 handle type
  *
- * This structure stores the configuration of the SSD1306 display and the I2C master device.
+ * This structure stores the configuration of the SSD1306 display, its controller and the transport it is connected through. On
+ * 4 bits per pixel controllers 'gray' holds a whole frame expanded to the RAM format, NULL on other controllers.
  */
 
 typedef struct
 {
-    i2c_master_dev_handle_t i2c_master_dev;
-    uint8_t i2c_addr;
-    uint32_t scl_speed_hz;
+    ssd1306_transport_t *transport;
+    const ssd1306_controller_t *controller;
+    bool horizontal_mode;
     uint8_t width;
     uint8_t height;
     uint8_t total_pages;
     ssd1306_page_t *page;
+    ssd1306_queue_page_t *queue;
+    uint8_t panel_width;
+    uint8_t panel_height;
+    ssd1306_wise_t wise;
+    ssd1306_rotation_t rotation;
+    bool mirror_x;
+    bool mirror_y;
+    uint8_t *gray;
 } i2c_ssd1306_handle_t;
 
+#ifdef ESP_PLATFORM
 esp_err_t i2c_ssd1306_init(i2c_ssd1306_handle_t *i2c_ssd1306, i2c_master_bus_handle_t i2c_master_bus, uint8_t i2c_addr, uint32_t i2c_scl_speed_hz, uint8_t width, uint8_t height, ssd1306_wise_t wise);
+esp_err_t i2c_ssd1306_spi_init(i2c_ssd1306_handle_t *i2c_ssd1306, const ssd1306_spi_config_t *spi_config, uint8_t width, uint8_t height, ssd1306_wise_t wise);
+#endif
+esp_err_t i2c_ssd1306_init_transport(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_transport_t *transport, const ssd1306_controller_t *controller, uint8_t width, uint8_t height, ssd1306_wise_t wise);
+void i2c_ssd1306_deinit(i2c_ssd1306_handle_t *i2c_ssd1306);
+esp_err_t i2c_ssd1306_set_orientation(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_rotation_t rotation, bool mirror_x, bool mirror_y);
+esp_err_t i2c_ssd1306_canvas_init(i2c_ssd1306_handle_t *canvas, uint8_t width, uint8_t height);
+void i2c_ssd1306_canvas_deinit(i2c_ssd1306_handle_t *canvas);
 void i2c_ssd1306_buffer_check(i2c_ssd1306_handle_t *i2c_ssd1306);
+void i2c_ssd1306_buffer_print(i2c_ssd1306_handle_t *i2c_ssd1306);
+uint16_t i2c_ssd1306_buffer_compare(i2c_ssd1306_handle_t *i2c_ssd1306, const uint8_t *golden);
 void i2c_ssd1306_buffer_clear(i2c_ssd1306_handle_t *i2c_ssd1306);
 void i2c_ssd1306_buffer_fill(i2c_ssd1306_handle_t *i2c_ssd1306, bool fill);
 void i2c_ssd1306_buffer_fill_pixel(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, bool fill);
@@ -59,7 +125,14 @@ void i2c_ssd1306_buffer_text(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8
 void i2c_ssd1306_buffer_int(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, int value, bool invert);
 void i2c_ssd1306_buffer_float(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, float value, uint8_t decimals, bool invert);
 void i2c_ssd1306_buffer_image(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const uint8_t *image, uint8_t width, uint8_t height, bool invert);
+void i2c_ssd1306_buffer_image_rle(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const uint8_t *rle, size_t rle_size, uint8_t width, uint8_t height, bool invert);
+void i2c_ssd1306_buffer_viewport(i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_handle_t *canvas, uint8_t x, uint8_t y);
 void i2c_ssd1306_segment_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page, uint8_t segment);
 void i2c_ssd1306_segments_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page, uint8_t initial_segment, uint8_t final_segment);
 void i2c_ssd1306_page_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page);
-void i2c_ssd1306_pages_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306);
\ No newline at end of file
+void i2c_ssd1306_pages_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306);
+void i2c_ssd1306_queue_segment(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page, uint8_t segment);
+void i2c_ssd1306_queue_segments(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page, uint8_t initial_segment, uint8_t final_segment);
+void i2c_ssd1306_queue_space(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2);
+void i2c_ssd1306_queue_clear(i2c_ssd1306_handle_t *i2c_ssd1306);
+uint16_t i2c_ssd1306_queue_flush(i2c_ssd1306_handle_t *i2c_ssd1306);
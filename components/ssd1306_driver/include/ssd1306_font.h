@@ -0,0 +1,403 @@
+#pragma once
+
+#include <stdint.h>
+
+/*  FONT DEFINED FROM ASCII 32 -> 127 */
+static uint8_t font8x8[256][8] = {
+    /*  ASCII CONTROL CHARACTERS */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 000 -> 0x00 [NULL]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 001 -> 0x01 [SOH]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 002 -> 0x02 [STX]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 003 -> 0x03 [ETX]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 004 -> 0x04 [EOT]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 005 -> 0x05 [ENQ]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 006 -> 0x06 [ACK]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 007 -> 0x07 [BEL]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 008 -> 0x08 [BS]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 009 -> 0x09 [TAB]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 010 -> 0x0A [LF]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 011 -> 0x0B [VT]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 012 -> 0x0C [FF]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 013 -> 0x0D [CR]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 014 -> 0x0E [SO]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 015 -> 0x0F [SI]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 016 -> 0x10 [DLE]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 017 -> 0x11 [DC1]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 018 -> 0x12 [DC2]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 019 -> 0x13 [DC3]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 020 -> 0x14 [DC4]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 021 -> 0x15 [NAK]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 022 -> 0x16 [SYN]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 023 -> 0x17 [ETB]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 024 -> 0x18 [CAN]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 025 -> 0x19 [EM]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 026 -> 0x1A [SUB]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 027 -> 0x1B [ESC]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 028 -> 0x1C [FS]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 029 -> 0x1D [GS]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 030 -> 0x1E [RS]
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 031 -> 0x1F [US]
+    /*  ASCII PRINTABLE CHARACTERS */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, //  032 -> 0x20 ( )
+    {0x00, 0x00, 0x00, 0x5F, 0x5F, 0x00, 0x00, 0x00}, //  033 -> 0x21 (!)
+    {0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00}, //  034 -> 0x22 (")
+    {0x14, 0x7F, 0x7F, 0x14, 0x7F, 0x7F, 0x14, 0x00}, //  035 -> 0x23 (#)
+    {0x00, 0x24, 0x2A, 0x7F, 0x7F, 0x2A, 0x12, 0x00}, //  036 -> 0x24 ($)
+    {0x46, 0x66, 0x30, 0x18, 0x0C, 0x66, 0x62, 0x00}, //  037 -> 0x25 (%)
+    {0x30, 0x7A, 0x4F, 0x5D, 0x37, 0x7A, 0x48, 0x00}, //  038 -> 0x26 (&)
+    {0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00}, //  039 -> 0x27 (')
+    {0x00, 0x00, 0x1C, 0x3E, 0x63, 0x41, 0x00, 0x00}, //  040 -> 0x28 (()
+    {0x00, 0x00, 0x41, 0x63, 0x3E, 0x1C, 0x00, 0x00}, //  041 -> 0x29 ())
+    {0x08, 0x2A, 0x3E, 0x1C, 0x1C, 0x3E, 0x2A, 0x08}, //  042 -> 0x2a (*)
+    {0x00, 0x08, 0x08, 0x3E, 0x3E, 0x08, 0x08, 0x00}, //  043 -> 0x2b (+)
+    {0x00, 0x00, 0x80, 0xE0, 0x60, 0x00, 0x00, 0x00}, //  044 -> 0x2c (,)
+    {0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00}, //  045 -> 0x2d (-)
+    {0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00}, //  046 -> 0x2e (.)
+    {0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00}, //  047 -> 0x2f (/)
+    {0x3E, 0x7F, 0x51, 0x49, 0x45, 0x7F, 0x3E, 0x00}, //  048 -> 0x30 (0)
+    {0x00, 0x40, 0x42, 0x7F, 0x7F, 0x40, 0x40, 0x00}, //  049 -> 0x31 (1)
+    {0x00, 0x72, 0x7B, 0x49, 0x49, 0x6F, 0x66, 0x00}, //  050 -> 0x32 (2)
+    {0x00, 0x22, 0x63, 0x49, 0x49, 0x7F, 0x36, 0x00}, //  051 -> 0x33 (3)
+    {0x18, 0x1C, 0x16, 0x53, 0x7F, 0x7F, 0x50, 0x00}, //  052 -> 0x34 (4)
+    {0x00, 0x2F, 0x6F, 0x49, 0x49, 0x79, 0x33, 0x00}, //  053 -> 0x35 (5)
+    {0x00, 0x3E, 0x7F, 0x49, 0x49, 0x7B, 0x32, 0x00}, //  054 -> 0x36 (6)
+    {0x00, 0x03, 0x03, 0x71, 0x79, 0x0F, 0x07, 0x00}, //  055 -> 0x37 (7)
+    {0x00, 0x36, 0x7F, 0x49, 0x49, 0x7F, 0x36, 0x00}, //  056 -> 0x38 (8)
+    {0x00, 0x26, 0x6F, 0x49, 0x49, 0x7F, 0x3E, 0x00}, //  057 -> 0x39 (9)
+    {0x00, 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x00, 0x00}, //  058 -> 0x3a (:)
+    {0x00, 0x00, 0x80, 0xEC, 0x6C, 0x00, 0x00, 0x00}, //  059 -> 0x3b (;)
+    {0x00, 0x08, 0x1C, 0x36, 0x63, 0x41, 0x00, 0x00}, //  060 -> 0x3c (<)
+    {0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00}, //  061 -> 0x3d (=)
+    {0x00, 0x41, 0x63, 0x36, 0x1C, 0x08, 0x00, 0x00}, //  062 -> 0x3e (>)
+    {0x00, 0x06, 0x07, 0x51, 0x59, 0x0F, 0x06, 0x00}, //  063 -> 0x3f (?)
+    {0x3E, 0x7F, 0x41, 0x5D, 0x5D, 0x5F, 0x1E, 0x00}, //  064 -> 0x40 (@)
+    {0x00, 0x7C, 0x7E, 0x13, 0x13, 0x7E, 0x7C, 0x00}, //  065 -> 0x41 (A)
+    {0x41, 0x7F, 0x7F, 0x49, 0x49, 0x7F, 0x36, 0x00}, //  066 -> 0x42 (B)
+    {0x1C, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x22, 0x00}, //  067 -> 0x43 (C)
+    {0x41, 0x7F, 0x7F, 0x41, 0x63, 0x3E, 0x1C, 0x00}, //  068 -> 0x44 (D)
+    {0x41, 0x7F, 0x7F, 0x49, 0x5D, 0x41, 0x63, 0x00}, //  069 -> 0x45 (E)
+    {0x41, 0x7F, 0x7F, 0x49, 0x1D, 0x01, 0x03, 0x00}, //  070 -> 0x46 (F)
+    {0x1C, 0x3E, 0x63, 0x41, 0x51, 0x73, 0x72, 0x00}, //  071 -> 0x47 (G)
+    {0x00, 0x7F, 0x7F, 0x08, 0x08, 0x7F, 0x7F, 0x00}, //  072 -> 0x48 (H)
+    {0x00, 0x41, 0x41, 0x7F, 0x7F, 0x41, 0x41, 0x00}, //  073 -> 0x49 (I)
+    {0x30, 0x70, 0x40, 0x41, 0x7F, 0x3F, 0x01, 0x00}, //  074 -> 0x4a (J)
+    {0x41, 0x7F, 0x7F, 0x08, 0x1C, 0x77, 0x63, 0x00}, //  075 -> 0x4b (K)
+    {0x41, 0x7F, 0x7F, 0x41, 0x40, 0x60, 0x70, 0x00}, //  076 -> 0x4c (L)
+    {0x7F, 0x7F, 0x0E, 0x1C, 0x0E, 0x7F, 0x7F, 0x00}, //  077 -> 0x4d (M)
+    {0x7F, 0x7F, 0x06, 0x0C, 0x18, 0x7F, 0x7F, 0x00}, //  078 -> 0x4e (N)
+    {0x1C, 0x3E, 0x63, 0x41, 0x63, 0x3E, 0x1C, 0x00}, //  079 -> 0x4f (O)
+    {0x41, 0x7F, 0x7F, 0x49, 0x09, 0x0F, 0x06, 0x00}, //  080 -> 0x50 (P)
+    {0x3C, 0x7E, 0x43, 0x51, 0x33, 0x6E, 0x5C, 0x00}, //  081 -> 0x51 (Q)
+    {0x41, 0x7F, 0x7F, 0x09, 0x19, 0x7F, 0x66, 0x00}, //  082 -> 0x52 (R)
+    {0x00, 0x26, 0x6F, 0x49, 0x49, 0x7B, 0x32, 0x00}, //  083 -> 0x53 (S)
+    {0x00, 0x03, 0x41, 0x7F, 0x7F, 0x41, 0x03, 0x00}, //  084 -> 0x54 (T)
+    {0x00, 0x3F, 0x7F, 0x40, 0x40, 0x7F, 0x3F, 0x00}, //  085 -> 0x55 (U)
+    {0x00, 0x1F, 0x3F, 0x60, 0x60, 0x3F, 0x1F, 0x00}, //  086 -> 0x56 (V)
+    {0x7F, 0x7F, 0x30, 0x18, 0x30, 0x7F, 0x7F, 0x00}, //  087 -> 0x57 (W)
+    {0x61, 0x73, 0x1E, 0x0C, 0x1E, 0x73, 0x61, 0x00}, //  088 -> 0x58 (X)
+    {0x00, 0x07, 0x4F, 0x78, 0x78, 0x4F, 0x07, 0x00}, //  089 -> 0x59 (Y)
+    {0x47, 0x63, 0x71, 0x59, 0x4D, 0x67, 0x73, 0x00}, //  090 -> 0x5a (Z)
+    {0x00, 0x00, 0x7F, 0x7F, 0x41, 0x41, 0x00, 0x00}, //  091 -> 0x5b ([)
+    {0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x00}, //  092 -> 0x5c (\)
+    {0x00, 0x00, 0x41, 0x41, 0x7F, 0x7F, 0x00, 0x00}, //  093 -> 0x5d (])
+    {0x08, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x08, 0x00}, //  094 -> 0x5e (^)
+    {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, //  095 -> 0x5f (_)
+    {0x00, 0x00, 0x01, 0x03, 0x06, 0x04, 0x00, 0x00}, //  096 -> 0x60 (`)
+    {0x20, 0x74, 0x54, 0x54, 0x3C, 0x78, 0x40, 0x00}, //  097 -> 0x61 (a)
+    {0x41, 0x7F, 0x3F, 0x44, 0x44, 0x7C, 0x38, 0x00}, //  098 -> 0x62 (b)
+    {0x00, 0x38, 0x7C, 0x44, 0x44, 0x6C, 0x28, 0x00}, //  099 -> 0x63 (c)
+    {0x38, 0x7C, 0x44, 0x45, 0x3F, 0x7F, 0x40, 0x00}, //  100 -> 0x64 (d)
+    {0x00, 0x38, 0x7C, 0x54, 0x54, 0x5C, 0x18, 0x00}, //  101 -> 0x65 (e)
+    {0x00, 0x48, 0x7E, 0x7F, 0x49, 0x03, 0x02, 0x00}, //  102 -> 0x66 (f)
+    {0x00, 0x98, 0xBC, 0xA4, 0xA4, 0xFC, 0x7C, 0x00}, //  103 -> 0x67 (g)
+    {0x41, 0x7F, 0x7F, 0x08, 0x04, 0x7C, 0x78, 0x00}, //  104 -> 0x68 (h)
+    {0x00, 0x00, 0x44, 0x7D, 0x7D, 0x40, 0x00, 0x00}, //  105 -> 0x69 (i)
+    {0x00, 0x60, 0xE0, 0x80, 0x84, 0xFD, 0x7D, 0x00}, //  106 -> 0x6a (j)
+    {0x41, 0x7F, 0x7F, 0x10, 0x38, 0x6C, 0x44, 0x00}, //  107 -> 0x6b (k)
+    {0x00, 0x00, 0x41, 0x7F, 0x7F, 0x40, 0x00, 0x00}, //  108 -> 0x6c (l)
+    {0x78, 0x7C, 0x0C, 0x38, 0x0C, 0x7C, 0x78, 0x00}, //  109 -> 0x6d (m)
+    {0x04, 0x7C, 0x78, 0x04, 0x04, 0x7C, 0x78, 0x00}, //  110 -> 0x6e (n)
+    {0x00, 0x38, 0x7C, 0x44, 0x44, 0x7C, 0x38, 0x00}, //  111 -> 0x6f (o)
+    {0x84, 0xFC, 0xF8, 0xA4, 0x24, 0x3C, 0x18, 0x00}, //  112 -> 0x70 (p)
+    {0x18, 0x3C, 0x24, 0xA4, 0xF8, 0xFC, 0x84, 0x00}, //  113 -> 0x71 (q)
+    {0x44, 0x7C, 0x78, 0x4C, 0x04, 0x0C, 0x08, 0x00}, //  114 -> 0x72 (r)
+    {0x00, 0x48, 0x5C, 0x54, 0x54, 0x74, 0x20, 0x00}, //  115 -> 0x73 (s)
+    {0x00, 0x04, 0x3F, 0x7F, 0x44, 0x64, 0x20, 0x00}, //  116 -> 0x74 (t)
+    {0x00, 0x3C, 0x7C, 0x40, 0x40, 0x7C, 0x7C, 0x00}, //  117 -> 0x75 (u)
+    {0x00, 0x1C, 0x3C, 0x60, 0x60, 0x3C, 0x1C, 0x00}, //  118 -> 0x76 (v)
+    {0x3C, 0x7C, 0x60, 0x38, 0x60, 0x7C, 0x3C, 0x00}, //  119 -> 0x77 (w)
+    {0x44, 0x6C, 0x38, 0x10, 0x38, 0x6C, 0x44, 0x00}, //  120 -> 0x78 (x)
+    {0x00, 0x9C, 0xBC, 0xA0, 0xA0, 0xFC, 0x7C, 0x00}, //  121 -> 0x79 (y)
+    {0x00, 0x4C, 0x64, 0x74, 0x5C, 0x4C, 0x64, 0x00}, //  122 -> 0x7a (z)
+    {0x00, 0x08, 0x08, 0x3E, 0x77, 0x41, 0x41, 0x00}, //  123 -> 0x7b ({)
+    {0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00}, //  124 -> 0x7c (|)
+    {0x00, 0x41, 0x41, 0x77, 0x3E, 0x08, 0x08, 0x00}, //  125 -> 0x7d (})
+    {0x10, 0x18, 0x08, 0x18, 0x10, 0x18, 0x08, 0x00}, //  126 -> 0x7e (~)
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 127 -> 0x7F [DEL]
+    /*  EXTENDED ASCII CHARACTERS */
+    {0x1C, 0x3E, 0x63, 0x41, 0xC1, 0xE3, 0x22, 0x00}, // 128 -> 0x80 (Ç)
+    {0x00, 0x3D, 0x7D, 0x40, 0x40, 0x7D, 0x7D, 0x00}, // 129 -> 0x81 (ü)
+    {0x00, 0x38, 0x7C, 0x56, 0x57, 0x5D, 0x18, 0x00}, // 130 -> 0x82 (é)
+    {0x20, 0x74, 0x56, 0x55, 0x3D, 0x7A, 0x40, 0x00}, // 131 -> 0x83 (â)
+    {0x20, 0x75, 0x55, 0x54, 0x3C, 0x79, 0x41, 0x00}, // 132 -> 0x84 (ä)
+    {0x20, 0x74, 0x55, 0x57, 0x3E, 0x78, 0x40, 0x00}, // 133 -> 0x85 (à)
+    {0x20, 0x74, 0x57, 0x55, 0x3F, 0x78, 0x40, 0x00}, // 134 -> 0x86 (å)
+    {0x00, 0x38, 0x7C, 0x44, 0xC4, 0xEC, 0x28, 0x00}, // 135 -> 0x87 (ç)
+    {0x00, 0x38, 0x7E, 0x55, 0x55, 0x5E, 0x18, 0x00}, // 136 -> 0x88 (ê)
+    {0x00, 0x39, 0x7D, 0x54, 0x54, 0x5D, 0x19, 0x00}, // 137 -> 0x89 (ë)
+    {0x00, 0x38, 0x7D, 0x57, 0x56, 0x5C, 0x18, 0x00}, // 138 -> 0x8A (è)
+    {0x00, 0x01, 0x45, 0x7C, 0x7C, 0x41, 0x01, 0x00}, // 139 -> 0x8B (ï)
+    {0x00, 0x00, 0x46, 0x7D, 0x7D, 0x42, 0x00, 0x00}, // 140 -> 0x8C (î)
+    {0x00, 0x00, 0x45, 0x7F, 0x7E, 0x40, 0x00, 0x00}, // 141 -> 0x8D (ì)
+    {0x00, 0xF9, 0xFD, 0x26, 0x26, 0xFD, 0xF9, 0x00}, // 142 -> 0x8E (Ä)
+    {0x00, 0xF8, 0xFD, 0x27, 0x27, 0xFC, 0xF8, 0x00}, // 143 -> 0x8F (Å)
+    {0x82, 0xFE, 0xFE, 0x92, 0xBB, 0x83, 0xC6, 0x00}, // 144 -> 0x90 (É)
+    {0x20, 0x54, 0x54, 0x38, 0x54, 0x54, 0x58, 0x00}, // 145 -> 0x91 (æ)
+    {0x7C, 0x7E, 0x0B, 0x09, 0x7F, 0x7F, 0x49, 0x00}, // 146 -> 0x92 (Æ)
+    {0x00, 0x38, 0x7E, 0x45, 0x45, 0x7E, 0x38, 0x00}, // 147 -> 0x93 (ô)
+    {0x00, 0x39, 0x7D, 0x44, 0x44, 0x7D, 0x39, 0x00}, // 148 -> 0x94 (ö)
+    {0x00, 0x38, 0x7D, 0x47, 0x46, 0x7C, 0x38, 0x00}, // 149 -> 0x95 (ò)
+    {0x00, 0x3C, 0x7E, 0x41, 0x41, 0x7E, 0x7C, 0x00}, // 150 -> 0x96 (û)
+    {0x00, 0x3C, 0x7D, 0x43, 0x42, 0x7C, 0x7C, 0x00}, // 151 -> 0x97 (ù)
+    {0x00, 0x9D, 0xBD, 0xA0, 0xA0, 0xFD, 0x7D, 0x00}, // 152 -> 0x98 (ÿ)
+    {0x38, 0x7D, 0xC7, 0x82, 0xC6, 0x7D, 0x39, 0x00}, // 153 -> 0x99 (Ö)
+    {0x00, 0x7F, 0xFF, 0x80, 0x80, 0xFF, 0x7F, 0x00}, // 154 -> 0x9A (Ü)
+    {0x00, 0x78, 0x7C, 0x54, 0x4C, 0x7C, 0x3A, 0x00}, // 155 -> 0x9B (ø)
+    {0x48, 0x7E, 0x7F, 0x49, 0x43, 0x62, 0x20, 0x00}, // 156 -> 0x9C (£)
+    {0x5C, 0x3E, 0x73, 0x49, 0x67, 0x3E, 0x1D, 0x00}, // 157 -> 0x9D (Ø)
+    {0x22, 0x36, 0x1C, 0x08, 0x1C, 0x36, 0x22, 0x00}, // 158 -> 0x9E (×)
+    {0x80, 0x88, 0x88, 0x7E, 0x7F, 0x09, 0x09, 0x00}, // 159 -> 0x9F (ƒ)
+    {0x20, 0x74, 0x54, 0x56, 0x3F, 0x79, 0x40, 0x00}, // 160 -> 0xA0 (á)
+    {0x00, 0x00, 0x44, 0x7E, 0x7F, 0x41, 0x00, 0x00}, // 161 -> 0xA1 (í)
+    {0x00, 0x38, 0x7C, 0x46, 0x47, 0x7D, 0x38, 0x00}, // 162 -> 0xA2 (ó)
+    {0x00, 0x3C, 0x7C, 0x42, 0x43, 0x7D, 0x7C, 0x00}, // 163 -> 0xA3 (ú)
+    {0x04, 0x7E, 0x79, 0x05, 0x06, 0x7E, 0x79, 0x00}, // 164 -> 0xA4 (ñ)
+    {0xFE, 0xFF, 0x0D, 0x18, 0x31, 0xFF, 0xFE, 0x00}, // 165 -> 0xA5 (Ñ)
+    {0x48, 0x5D, 0x55, 0x55, 0x5F, 0x5E, 0x00, 0x00}, // 166 -> 0xA6 (ª)
+    {0x00, 0x26, 0x2F, 0x29, 0x2F, 0x26, 0x00, 0x00}, // 167 -> 0xA7 (º)
+    {0x30, 0x78, 0x4D, 0x45, 0x70, 0x30, 0x00, 0x00}, // 168 -> 0xA8 (¿)
+    {0x3E, 0x41, 0x7D, 0x55, 0x6D, 0x41, 0x3E, 0x00}, // 169 -> 0xA9 (®)
+    {0x04, 0x04, 0x04, 0x04, 0x04, 0x1C, 0x1C, 0x00}, // 170 -> 0xAA (¬)
+    {0x41, 0x27, 0x10, 0x08, 0x44, 0x6A, 0x59, 0x00}, // 171 -> 0xAB (½)
+    {0x41, 0x27, 0x10, 0x28, 0x34, 0x7A, 0x21, 0x00}, // 172 -> 0xAC (¼)
+    {0x00, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x00}, // 173 -> 0xAD (¡)
+    {0x08, 0x1C, 0x36, 0x08, 0x1C, 0x36, 0x00, 0x00}, // 174 -> 0xAE («)
+    {0x00, 0x36, 0x1C, 0x08, 0x36, 0x1C, 0x08, 0x00}, // 175 -> 0xAF (»)
+    {0x55, 0x00, 0xAA, 0x00, 0x55, 0x00, 0xAA, 0x00}, // 176 -> 0xB0 (░)
+    {0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA}, // 177 -> 0xB1 (▒)
+    {0xAA, 0xFF, 0x55, 0xFF, 0xAA, 0xFF, 0x55, 0xFF}, // 178 -> 0xB2 (▓)
+    {0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00}, // 179 -> 0xB3 (│)
+    {0x08, 0x08, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00}, // 180 -> 0xB4 (┤)
+    {0x00, 0xF8, 0xFC, 0x26, 0x27, 0xFD, 0xF8, 0x00}, // 181 -> 0xB5 (Á)
+    {0x00, 0xF8, 0xFD, 0x27, 0x27, 0xFC, 0xF8, 0x00}, // 182 -> 0xB6 (Â)
+    {0x00, 0xF8, 0xFD, 0x27, 0x26, 0xFC, 0xF8, 0x00}, // 183 -> 0xB7 (À)
+    {0x3E, 0x41, 0x5D, 0x55, 0x55, 0x41, 0x3E, 0x00}, // 184 -> 0xB8 (©)
+    {0x14, 0x14, 0xF7, 0x00, 0xFF, 0x00, 0x00, 0x00}, // 185 -> 0xB9 (╣)
+    {0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00}, // 186 -> 0xBA (║)
+    {0x14, 0x14, 0xF4, 0x04, 0xFC, 0x00, 0x00, 0x00}, // 187 -> 0xBB (╗)
+    {0x14, 0x14, 0x17, 0x10, 0x1F, 0x00, 0x00, 0x00}, // 188 -> 0xBC (╝)
+    {0x00, 0x1C, 0x3E, 0x63, 0x63, 0x36, 0x14, 0x00}, // 189 -> 0xBD (¢)
+    {0x00, 0x2B, 0x2F, 0x7C, 0x7C, 0x2F, 0x2B, 0x00}, // 190 -> 0xBE (¥)
+    {0x08, 0x08, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00}, // 191 -> 0xBF (┐)
+    {0x00, 0x00, 0x00, 0x0F, 0x08, 0x08, 0x08, 0x08}, // 192 -> 0xC0 (└)
+    {0x08, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x08, 0x08}, // 193 -> 0xC1 (┴)
+    {0x08, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x08, 0x08}, // 194 -> 0xC2 (┬)
+    {0x00, 0x00, 0x00, 0xFF, 0x08, 0x08, 0x08, 0x08}, // 195 -> 0xC3 (├)
+    {0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08}, // 196 -> 0xC4 (─)
+    {0x08, 0x08, 0x08, 0xFF, 0x08, 0x08, 0x08, 0x08}, // 197 -> 0xC5 (┼)
+    {0x20, 0x76, 0x55, 0x55, 0x3E, 0x7A, 0x41, 0x00}, // 198 -> 0xC6 (ã)
+    {0x00, 0xF9, 0xFD, 0x26, 0x27, 0xFD, 0xF8, 0x00}, // 199 -> 0xC7 (Ã)
+    {0x00, 0x00, 0x1F, 0x10, 0x17, 0x14, 0x14, 0x14}, // 200 -> 0xC8 (╚)
+    {0x00, 0x00, 0xFC, 0x04, 0xF4, 0x14, 0x14, 0x14}, // 201 -> 0xC9 (╔)
+    {0x14, 0x14, 0x17, 0x10, 0x17, 0x14, 0x14, 0x14}, // 202 -> 0xCA (╩)
+    {0x14, 0x14, 0xF4, 0x04, 0xF4, 0x14, 0x14, 0x14}, // 203 -> 0xCB (╦)
+    {0x00, 0x00, 0xFF, 0x00, 0xF7, 0x14, 0x14, 0x14}, // 204 -> 0xCC (╠)
+    {0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14}, // 205 -> 0xCD (═)
+    {0x14, 0x14, 0xF7, 0x00, 0xF7, 0x14, 0x14, 0x14}, // 206 -> 0xCE (╬)
+    {0x22, 0x3E, 0x1C, 0x14, 0x1C, 0x3E, 0x22, 0x00}, // 207 -> 0xCF (¤)
+    {0x00, 0x30, 0x7D, 0x4B, 0x4E, 0x7D, 0x38, 0x00}, // 208 -> 0xD0 (ð)
+    {0x49, 0x7F, 0x7F, 0x49, 0x63, 0x3E, 0x1C, 0x00}, // 209 -> 0xD1 (Ð)
+    {0x82, 0xFE, 0xFF, 0x93, 0xBB, 0x82, 0xC6, 0x00}, // 210 -> 0xD2 (Ê)
+    {0x82, 0xFF, 0xFF, 0x92, 0xBA, 0x83, 0xC7, 0x00}, // 211 -> 0xD3 (Ë)
+    {0x82, 0xFE, 0xFF, 0x93, 0xBA, 0x82, 0xC6, 0x00}, // 212 -> 0xD4 (È)
+    {0x00, 0x00, 0x44, 0x7C, 0x7C, 0x40, 0x00, 0x00}, // 213 -> 0xD5 (ı)
+    {0x00, 0x82, 0x82, 0xFE, 0xFF, 0x83, 0x82, 0x00}, // 214 -> 0xD6 (Í)
+    {0x00, 0x82, 0x83, 0xFF, 0xFF, 0x82, 0x82, 0x00}, // 215 -> 0xD7 (Î)
+    {0x00, 0x83, 0x83, 0xFE, 0xFE, 0x83, 0x83, 0x00}, // 216 -> 0xD8 (Ï)
+    {0x08, 0x08, 0x08, 0x0F, 0x00, 0x00, 0x00, 0x00}, // 217 -> 0xD9 (┘)
+    {0x00, 0x00, 0x00, 0xF8, 0x08, 0x08, 0x08, 0x08}, // 218 -> 0xDA (┌)
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, // 219 -> 0xDB (█)
+    {0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0}, // 220 -> 0xDC (▄)
+    {0x00, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00}, // 221 -> 0xDD (¦)
+    {0x00, 0x82, 0x83, 0xFF, 0xFE, 0x82, 0x82, 0x00}, // 222 -> 0xDE (Ì)
+    {0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F}, // 223 -> 0xDF (▀)
+    {0x38, 0x7C, 0xC6, 0x82, 0xC7, 0x7D, 0x38, 0x00}, // 224 -> 0xE0 (Ó)
+    {0x00, 0xFE, 0xFF, 0x09, 0x5F, 0x76, 0x20, 0x00}, // 225 -> 0xE1 (ß)
+    {0x38, 0x7C, 0xC7, 0x83, 0xC7, 0x7C, 0x38, 0x00}, // 226 -> 0xE2 (Ô)
+    {0x38, 0x7C, 0xC7, 0x83, 0xC6, 0x7C, 0x38, 0x00}, // 227 -> 0xE3 (Ò)
+    {0x00, 0x3A, 0x7D, 0x45, 0x46, 0x7E, 0x39, 0x00}, // 228 -> 0xE4 (õ)
+    {0x38, 0x7D, 0xC7, 0x82, 0xC7, 0x7D, 0x38, 0x00}, // 229 -> 0xE5 (Õ)
+    {0x00, 0xFC, 0xFC, 0x40, 0x40, 0x7C, 0x7C, 0x00}, // 230 -> 0xE6 (µ)
+    {0x81, 0xFF, 0xFF, 0xA4, 0x24, 0x3C, 0x18, 0x00}, // 231 -> 0xE7 (þ)
+    {0x41, 0x7F, 0x7F, 0x55, 0x14, 0x1C, 0x08, 0x00}, // 232 -> 0xE8 (Þ)
+    {0x00, 0x7E, 0xFE, 0x80, 0x81, 0xFF, 0x7E, 0x00}, // 233 -> 0xE9 (Ú)
+    {0x00, 0x7E, 0xFF, 0x81, 0x81, 0xFE, 0x7E, 0x00}, // 234 -> 0xEA (Û)
+    {0x00, 0x7E, 0xFF, 0x81, 0x80, 0xFE, 0x7E, 0x00}, // 235 -> 0xEB (Ù)
+    {0x00, 0x9C, 0xBC, 0xA2, 0xA3, 0xFD, 0x7C, 0x00}, // 236 -> 0xEC (ý)
+    {0x00, 0x0E, 0x9E, 0xF0, 0xF1, 0x9F, 0x0E, 0x00}, // 237 -> 0xED (Ý)
+    {0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00}, // 238 -> 0xEE (¯)
+    {0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00, 0x00}, // 239 -> 0xEF (´)
+    {0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x00}, // 240 -> 0xF0 (≡)
+    {0x00, 0x44, 0x44, 0x5F, 0x5F, 0x44, 0x44, 0x00}, // 241 -> 0xF1 (±)
+    {0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0}, // 242 -> 0xF2 (‗)
+    {0x55, 0x3F, 0x10, 0x28, 0x34, 0x7A, 0x21, 0x00}, // 243 -> 0xF3 (¾)
+    {0x06, 0x0F, 0x0F, 0x7F, 0x01, 0x7F, 0x7F, 0x00}, // 244 -> 0xF4 (¶)
+    {0x00, 0x0A, 0x5F, 0x55, 0x55, 0x7D, 0x28, 0x00}, // 245 -> 0xF5 (§)
+    {0x00, 0x04, 0x04, 0x15, 0x15, 0x04, 0x04, 0x00}, // 246 -> 0xF6 (÷)
+    {0x00, 0x00, 0x80, 0x80, 0xC0, 0x40, 0x00, 0x00}, // 247 -> 0xF7 (¸)
+    {0x00, 0x02, 0x07, 0x05, 0x07, 0x02, 0x00, 0x00}, // 248 -> 0xF8 (°)
+    {0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00}, // 249 -> 0xF9 (¨)
+    {0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00}, // 250 -> 0xFA (·)
+    {0x00, 0x0A, 0x0F, 0x0F, 0x08, 0x00, 0x00, 0x00}, // 251 -> 0xFB (¹)
+    {0x00, 0x09, 0x0B, 0x0F, 0x06, 0x00, 0x00, 0x00}, // 252 -> 0xFC (³)
+    {0x00, 0x09, 0x0D, 0x0F, 0x0A, 0x00, 0x00, 0x00}, // 253 -> 0xFD (²)
+    {0x00, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x00}, // 254 -> 0xFE (■)
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}  // 255 -> 0xFF ( )
+};
+
+/*  GREEK AND CYRILLIC CHARACTERS, GLYPHS 256 AND UP */
+static const uint8_t font8x8_ext[][8] = {
+    {0x41, 0x7F, 0x7F, 0x41, 0x01, 0x01, 0x03, 0x00}, // 256 -> 0x393 (Γ)
+    {0x70, 0x7C, 0x4E, 0x43, 0x4E, 0x7C, 0x70, 0x00}, // 257 -> 0x394 (Δ)
+    {0x1C, 0x3E, 0x6B, 0x49, 0x6B, 0x3E, 0x1C, 0x00}, // 258 -> 0x398 (Θ)
+    {0x70, 0x7C, 0x0E, 0x03, 0x0E, 0x7C, 0x70, 0x00}, // 259 -> 0x39B (Λ)
+    {0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x41, 0x00}, // 260 -> 0x39E (Ξ)
+    {0x7F, 0x7F, 0x01, 0x01, 0x01, 0x7F, 0x7F, 0x00}, // 261 -> 0x3A0 (Π)
+    {0x63, 0x77, 0x5D, 0x49, 0x41, 0x41, 0x63, 0x00}, // 262 -> 0x3A3 (Σ)
+    {0x1C, 0x3E, 0x22, 0x7F, 0x22, 0x3E, 0x1C, 0x00}, // 263 -> 0x3A6 (Φ)
+    {0x07, 0x0F, 0x48, 0x7F, 0x48, 0x0F, 0x07, 0x00}, // 264 -> 0x3A8 (Ψ)
+    {0x4C, 0x5E, 0x73, 0x01, 0x73, 0x5E, 0x4C, 0x00}, // 265 -> 0x3A9 (Ω)
+    {0x38, 0x7C, 0x44, 0x6C, 0x38, 0x7C, 0x44, 0x00}, // 266 -> 0x3B1 (α)
+    {0x00, 0xFE, 0xFF, 0x49, 0x7F, 0x36, 0x00, 0x00}, // 267 -> 0x3B2 (β)
+    {0x04, 0x0C, 0xF8, 0xF0, 0x18, 0x0C, 0x04, 0x00}, // 268 -> 0x3B3 (γ)
+    {0x30, 0x7A, 0x4F, 0x4D, 0x79, 0x31, 0x00, 0x00}, // 269 -> 0x3B4 (δ)
+    {0x28, 0x7C, 0x54, 0x54, 0x44, 0x00, 0x00, 0x00}, // 270 -> 0x3B5 (ε)
+    {0x31, 0x79, 0x4D, 0x47, 0xC3, 0x81, 0x00, 0x00}, // 271 -> 0x3B6 (ζ)
+    {0x04, 0x7C, 0x78, 0x04, 0x04, 0xFC, 0xF8, 0x00}, // 272 -> 0x3B7 (η)
+    {0x00, 0x3E, 0x7F, 0x49, 0x7F, 0x3E, 0x00, 0x00}, // 273 -> 0x3B8 (θ)
+    {0x00, 0x00, 0x04, 0x3C, 0x7C, 0x40, 0x20, 0x00}, // 274 -> 0x3B9 (ι)
+    {0x00, 0x7C, 0x7C, 0x10, 0x38, 0x6C, 0x44, 0x00}, // 275 -> 0x3BA (κ)
+    {0x71, 0x7B, 0x0E, 0x0C, 0x38, 0x70, 0x40, 0x00}, // 276 -> 0x3BB (λ)
+    {0x11, 0x3B, 0x2F, 0x25, 0xA5, 0xE5, 0x40, 0x00}, // 277 -> 0x3BE (ξ)
+    {0x04, 0x7C, 0x7C, 0x04, 0x7C, 0x7C, 0x04, 0x00}, // 278 -> 0x3C0 (π)
+    {0x00, 0xF8, 0xFC, 0x24, 0x24, 0x3C, 0x18, 0x00}, // 279 -> 0x3C1 (ρ)
+    {0x00, 0x18, 0x3C, 0x24, 0xA4, 0xE4, 0x40, 0x00}, // 280 -> 0x3C2 (ς)
+    {0x00, 0x38, 0x7C, 0x44, 0x4C, 0x7C, 0x34, 0x00}, // 281 -> 0x3C3 (σ)
+    {0x00, 0x04, 0x04, 0x3C, 0x7C, 0x44, 0x24, 0x00}, // 282 -> 0x3C4 (τ)
+    {0x00, 0x3C, 0x7C, 0x40, 0x40, 0x7C, 0x3C, 0x00}, // 283 -> 0x3C5 (υ)
+    {0x18, 0x3C, 0x24, 0xFE, 0x24, 0x3C, 0x18, 0x00}, // 284 -> 0x3C6 (φ)
+    {0x44, 0x6C, 0x38, 0x10, 0x38, 0x6C, 0x44, 0x00}, // 285 -> 0x3C7 (χ)
+    {0x1C, 0x3C, 0x20, 0xFE, 0x20, 0x3C, 0x1C, 0x00}, // 286 -> 0x3C8 (ψ)
+    {0x3C, 0x7C, 0x40, 0x30, 0x40, 0x7C, 0x3C, 0x00}, // 287 -> 0x3C9 (ω)
+    {0x41, 0x7F, 0x7F, 0x49, 0x49, 0x79, 0x33, 0x00}, // 288 -> 0x411 (Б)
+    {0x60, 0x7E, 0x3F, 0x21, 0x3F, 0x7F, 0x60, 0x00}, // 289 -> 0x414 (Д)
+    {0x63, 0x77, 0x1C, 0x7F, 0x1C, 0x77, 0x63, 0x00}, // 290 -> 0x416 (Ж)
+    {0x22, 0x63, 0x49, 0x49, 0x7F, 0x36, 0x00, 0x00}, // 291 -> 0x417 (З)
+    {0x7F, 0x7F, 0x18, 0x0C, 0x06, 0x7F, 0x7F, 0x00}, // 292 -> 0x418 (И)
+    {0xFE, 0xFF, 0x31, 0x18, 0x0D, 0xFF, 0xFE, 0x00}, // 293 -> 0x419 (Й)
+    {0x40, 0x7E, 0x3F, 0x01, 0x01, 0x7F, 0x7F, 0x00}, // 294 -> 0x41B (Л)
+    {0x27, 0x6F, 0x48, 0x48, 0x48, 0x7F, 0x3F, 0x00}, // 295 -> 0x423 (У)
+    {0x7F, 0x7F, 0x40, 0x40, 0x7F, 0xFF, 0xC0, 0x00}, // 296 -> 0x426 (Ц)
+    {0x07, 0x0F, 0x08, 0x08, 0x08, 0x7F, 0x7F, 0x00}, // 297 -> 0x427 (Ч)
+    {0x7F, 0x7F, 0x40, 0x7F, 0x40, 0x7F, 0x7F, 0x00}, // 298 -> 0x428 (Ш)
+    {0x7F, 0x7F, 0x40, 0x7F, 0x40, 0x7F, 0xFF, 0x00}, // 299 -> 0x429 (Щ)
+    {0x01, 0x7F, 0x7F, 0x48, 0x48, 0x78, 0x30, 0x00}, // 300 -> 0x42A (Ъ)
+    {0x7F, 0x7F, 0x48, 0x78, 0x00, 0x7F, 0x7F, 0x00}, // 301 -> 0x42B (Ы)
+    {0x00, 0x7F, 0x7F, 0x48, 0x48, 0x78, 0x30, 0x00}, // 302 -> 0x42C (Ь)
+    {0x22, 0x63, 0x49, 0x49, 0x7F, 0x3E, 0x00, 0x00}, // 303 -> 0x42D (Э)
+    {0x7F, 0x7F, 0x08, 0x3E, 0x41, 0x41, 0x3E, 0x00}, // 304 -> 0x42E (Ю)
+    {0x46, 0x6F, 0x39, 0x19, 0x7F, 0x7F, 0x00, 0x00}, // 305 -> 0x42F (Я)
+    {0x00, 0x3E, 0x7F, 0x45, 0x45, 0x7D, 0x38, 0x00}, // 306 -> 0x431 (б)
+    {0x00, 0x7C, 0x7C, 0x54, 0x54, 0x7C, 0x28, 0x00}, // 307 -> 0x432 (в)
+    {0x00, 0x7C, 0x7C, 0x04, 0x04, 0x04, 0x04, 0x00}, // 308 -> 0x433 (г)
+    {0xC0, 0xF8, 0x7C, 0x44, 0x7C, 0xFC, 0xC0, 0x00}, // 309 -> 0x434 (д)
+    {0x44, 0x6C, 0x38, 0x7C, 0x38, 0x6C, 0x44, 0x00}, // 310 -> 0x436 (ж)
+    {0x00, 0x44, 0x54, 0x54, 0x7C, 0x28, 0x00, 0x00}, // 311 -> 0x437 (з)
+    {0x00, 0x7C, 0x7C, 0x30, 0x18, 0x7C, 0x7C, 0x00}, // 312 -> 0x438 (и)
+    {0x00, 0x7D, 0x7E, 0x32, 0x1A, 0x7D, 0x7C, 0x00}, // 313 -> 0x439 (й)
+    {0x40, 0x78, 0x3C, 0x04, 0x04, 0x7C, 0x7C, 0x00}, // 314 -> 0x43B (л)
+    {0x7C, 0x7C, 0x08, 0x10, 0x08, 0x7C, 0x7C, 0x00}, // 315 -> 0x43C (м)
+    {0x00, 0x7C, 0x7C, 0x10, 0x10, 0x7C, 0x7C, 0x00}, // 316 -> 0x43D (н)
+    {0x00, 0x7C, 0x7C, 0x04, 0x04, 0x7C, 0x7C, 0x00}, // 317 -> 0x43F (п)
+    {0x00, 0x04, 0x04, 0x7C, 0x7C, 0x04, 0x04, 0x00}, // 318 -> 0x442 (т)
+    {0x7C, 0x7C, 0x40, 0x40, 0x7C, 0xFC, 0xC0, 0x00}, // 319 -> 0x446 (ц)
+    {0x00, 0x0C, 0x1C, 0x10, 0x10, 0x7C, 0x7C, 0x00}, // 320 -> 0x447 (ч)
+    {0x7C, 0x7C, 0x40, 0x7C, 0x40, 0x7C, 0x7C, 0x00}, // 321 -> 0x448 (ш)
+    {0x7C, 0x7C, 0x40, 0x7C, 0x40, 0x7C, 0xFC, 0x00}, // 322 -> 0x449 (щ)
+    {0x04, 0x7C, 0x7C, 0x50, 0x50, 0x70, 0x20, 0x00}, // 323 -> 0x44A (ъ)
+    {0x7C, 0x7C, 0x50, 0x70, 0x00, 0x7C, 0x7C, 0x00}, // 324 -> 0x44B (ы)
+    {0x00, 0x7C, 0x7C, 0x50, 0x50, 0x70, 0x20, 0x00}, // 325 -> 0x44C (ь)
+    {0x00, 0x44, 0x54, 0x54, 0x7C, 0x38, 0x00, 0x00}, // 326 -> 0x44D (э)
+    {0x7C, 0x7C, 0x10, 0x38, 0x44, 0x44, 0x38, 0x00}, // 327 -> 0x44E (ю)
+    {0x00, 0x48, 0x7C, 0x34, 0x14, 0x7C, 0x7C, 0x00}  // 328 -> 0x44F (я)
+};
+
+/**
+ * @brief SSD1306 glyph index entry type
+ *
+ * This structure maps a Unicode codepoint to a glyph. Glyphs below 256 are rows of font8x8, the others are rows of
+ * font8x8_ext starting at 256. Letters that look like a Latin letter share its glyph.
+ *
+ * - codepoint: Unicode codepoint.
+ * - glyph: Glyph number.
+ */
+typedef struct
+{
+    uint16_t codepoint;
+    uint16_t glyph;
+} ssd1306_glyph_index_t;
+
+/*  NON ASCII CODEPOINTS, SORTED FOR BINARY SEARCH */
+static const ssd1306_glyph_index_t font8x8_index[] = {
+    {0x00A0, 255}, {0x00A1, 173}, {0x00A2, 189}, {0x00A3, 156}, {0x00A4, 207}, {0x00A5, 190},
+    {0x00A6, 221}, {0x00A7, 245}, {0x00A8, 249}, {0x00A9, 184}, {0x00AA, 166}, {0x00AB, 174},
+    {0x00AC, 170}, {0x00AE, 169}, {0x00AF, 238}, {0x00B0, 248}, {0x00B1, 241}, {0x00B2, 253},
+    {0x00B3, 252}, {0x00B4, 239}, {0x00B5, 230}, {0x00B6, 244}, {0x00B7, 250}, {0x00B8, 247},
+    {0x00B9, 251}, {0x00BA, 167}, {0x00BB, 175}, {0x00BC, 172}, {0x00BD, 171}, {0x00BE, 243},
+    {0x00BF, 168}, {0x00C0, 183}, {0x00C1, 181}, {0x00C2, 182}, {0x00C3, 199}, {0x00C4, 142},
+    {0x00C5, 143}, {0x00C6, 146}, {0x00C7, 128}, {0x00C8, 212}, {0x00C9, 144}, {0x00CA, 210},
+    {0x00CB, 211}, {0x00CC, 222}, {0x00CD, 214}, {0x00CE, 215}, {0x00CF, 216}, {0x00D0, 209},
+    {0x00D1, 165}, {0x00D2, 227}, {0x00D3, 224}, {0x00D4, 226}, {0x00D5, 229}, {0x00D6, 153},
+    {0x00D7, 158}, {0x00D8, 157}, {0x00D9, 235}, {0x00DA, 233}, {0x00DB, 234}, {0x00DC, 154},
+    {0x00DD, 237}, {0x00DE, 232}, {0x00DF, 225}, {0x00E0, 133}, {0x00E1, 160}, {0x00E2, 131},
+    {0x00E3, 198}, {0x00E4, 132}, {0x00E5, 134}, {0x00E6, 145}, {0x00E7, 135}, {0x00E8, 138},
+    {0x00E9, 130}, {0x00EA, 136}, {0x00EB, 137}, {0x00EC, 141}, {0x00ED, 161}, {0x00EE, 140},
+    {0x00EF, 139}, {0x00F0, 208}, {0x00F1, 164}, {0x00F2, 149}, {0x00F3, 162}, {0x00F4, 147},
+    {0x00F5, 228}, {0x00F6, 148}, {0x00F7, 246}, {0x00F8, 155}, {0x00F9, 151}, {0x00FA, 163},
+    {0x00FB, 150}, {0x00FC, 129}, {0x00FD, 236}, {0x00FE, 231}, {0x00FF, 152}, {0x0131, 213},
+    {0x0192, 159}, {0x0391, 65}, {0x0392, 66}, {0x0393, 256}, {0x0394, 257}, {0x0395, 69},
+    {0x0396, 90}, {0x0397, 72}, {0x0398, 258}, {0x0399, 73}, {0x039A, 75}, {0x039B, 259},
+    {0x039C, 77}, {0x039D, 78}, {0x039E, 260}, {0x039F, 79}, {0x03A0, 261}, {0x03A1, 80},
+    {0x03A3, 262}, {0x03A4, 84}, {0x03A5, 89}, {0x03A6, 263}, {0x03A7, 88}, {0x03A8, 264},
+    {0x03A9, 265}, {0x03B1, 266}, {0x03B2, 267}, {0x03B3, 268}, {0x03B4, 269}, {0x03B5, 270},
+    {0x03B6, 271}, {0x03B7, 272}, {0x03B8, 273}, {0x03B9, 274}, {0x03BA, 275}, {0x03BB, 276},
+    {0x03BC, 230}, {0x03BD, 118}, {0x03BE, 277}, {0x03BF, 111}, {0x03C0, 278}, {0x03C1, 279},
+    {0x03C2, 280}, {0x03C3, 281}, {0x03C4, 282}, {0x03C5, 283}, {0x03C6, 284}, {0x03C7, 285},
+    {0x03C8, 286}, {0x03C9, 287}, {0x0401, 211}, {0x0410, 65}, {0x0411, 288}, {0x0412, 66},
+    {0x0413, 256}, {0x0414, 289}, {0x0415, 69}, {0x0416, 290}, {0x0417, 291}, {0x0418, 292},
+    {0x0419, 293}, {0x041A, 75}, {0x041B, 294}, {0x041C, 77}, {0x041D, 72}, {0x041E, 79},
+    {0x041F, 261}, {0x0420, 80}, {0x0421, 67}, {0x0422, 84}, {0x0423, 295}, {0x0424, 263},
+    {0x0425, 88}, {0x0426, 296}, {0x0427, 297}, {0x0428, 298}, {0x0429, 299}, {0x042A, 300},
+    {0x042B, 301}, {0x042C, 302}, {0x042D, 303}, {0x042E, 304}, {0x042F, 305}, {0x0430, 97},
+    {0x0431, 306}, {0x0432, 307}, {0x0433, 308}, {0x0434, 309}, {0x0435, 101}, {0x0436, 310},
+    {0x0437, 311}, {0x0438, 312}, {0x0439, 313}, {0x043A, 275}, {0x043B, 314}, {0x043C, 315},
+    {0x043D, 316}, {0x043E, 111}, {0x043F, 317}, {0x0440, 112}, {0x0441, 99}, {0x0442, 318},
+    {0x0443, 121}, {0x0444, 284}, {0x0445, 120}, {0x0446, 319}, {0x0447, 320}, {0x0448, 321},
+    {0x0449, 322}, {0x044A, 323}, {0x044B, 324}, {0x044C, 325}, {0x044D, 326}, {0x044E, 327},
+    {0x044F, 328}, {0x0451, 137}, {0x2017, 242}, {0x2261, 240}, {0x2500, 196}, {0x2502, 179},
+    {0x250C, 218}, {0x2510, 191}, {0x2514, 192}, {0x2518, 217}, {0x251C, 195}, {0x2524, 180},
+    {0x252C, 194}, {0x2534, 193}, {0x253C, 197}, {0x2550, 205}, {0x2551, 186}, {0x2554, 201},
+    {0x2557, 187}, {0x255A, 200}, {0x255D, 188}, {0x2560, 204}, {0x2563, 185}, {0x2566, 203},
+    {0x2569, 202}, {0x256C, 206}, {0x2580, 223}, {0x2584, 220}, {0x2588, 219}, {0x2591, 176},
+    {0x2592, 177}, {0x2593, 178}, {0x25A0, 254}
+};
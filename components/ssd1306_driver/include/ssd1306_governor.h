@@ -0,0 +1,83 @@
+#pragma once
+
+#include "ssd1306_driver.h"
+#include "esp_timer.h"
+
+#define SSD1306_GOVERNOR_TAG "SSD1306 Governor"
+
+/**
+ * @brief SSD1306 power state type
+ *
+ * This enumeration defines the power state the governor keeps the SSD1306 display in.
+ */
+typedef enum
+{
+    SSD1306_POWER_ACTIVE,
+    SSD1306_POWER_DIM,
+    SSD1306_POWER_SLEEP
+} ssd1306_power_state_t;
+
+/**
+ * @brief SSD1306 governor configuration type
+ *
+ * This structure stores the refresh and power policy of the governor. Timeouts of 0 disable the corresponding state.
+ *
+ * - max_fps: Maximum number of flushes per second.
+ * - latency_ms: Longest time a change is held back by the frame rate cap, 0 for no limit.
+ * - dim_timeout_ms: Time without changes before the contrast is lowered to dim_contrast.
+ * - sleep_timeout_ms: Time without changes before the display is turned off.
+ * - contrast: Contrast while active.
+ * - dim_contrast: Contrast while dimmed.
+ */
+typedef struct
+{
+    uint8_t max_fps;
+    uint32_t latency_ms;
+    uint32_t dim_timeout_ms;
+    uint32_t sleep_timeout_ms;
+    uint8_t contrast;
+    uint8_t dim_contrast;
+} ssd1306_governor_config_t;
+
+/**
+ * @brief SSD1306 governor statistics type
+ *
+ * This structure stores the activity of the governor since the last reset. Times are in microseconds.
+ */
+typedef struct
+{
+    uint32_t flushes;
+    uint32_t transmissions;
+    uint32_t polls;
+    int64_t busy_us;
+    int64_t since_us;
+} ssd1306_governor_stats_t;
+
+/**
+ * @brief I2C SSD1306 governor handle type
+ *
+ * This structure stores the policy, the last transferred frame and the timing state of the governor.
+ */
+typedef struct
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306;
+    ssd1306_governor_config_t config;
+    ssd1306_power_state_t state;
+    uint8_t width;
+    uint8_t total_pages;
+    uint8_t *shadow;
+    bool ram_valid;
+    bool pending;
+    int64_t first_change_us;
+    int64_t last_change_us;
+    int64_t last_flush_us;
+    ssd1306_governor_stats_t stats;
+} i2c_ssd1306_governor_handle_t;
+
+esp_err_t i2c_ssd1306_governor_init(i2c_ssd1306_governor_handle_t *governor, i2c_ssd1306_handle_t *i2c_ssd1306, const ssd1306_governor_config_t *config);
+void i2c_ssd1306_governor_deinit(i2c_ssd1306_governor_handle_t *governor);
+int64_t i2c_ssd1306_governor_poll(i2c_ssd1306_governor_handle_t *governor);
+esp_err_t i2c_ssd1306_governor_set_state(i2c_ssd1306_governor_handle_t *governor, ssd1306_power_state_t state);
+void i2c_ssd1306_governor_get_stats(i2c_ssd1306_governor_handle_t *governor, ssd1306_governor_stats_t *stats);
+void i2c_ssd1306_governor_reset_stats(i2c_ssd1306_governor_handle_t *governor);
+float i2c_ssd1306_governor_duty_cycle(i2c_ssd1306_governor_handle_t *governor);
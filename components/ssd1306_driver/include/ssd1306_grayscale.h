@@ -0,0 +1,81 @@
+#pragma once
+
+#include "ssd1306_driver.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+
+#define SSD1306_GRAYSCALE_TAG "SSD1306 Grayscale"
+
+#define SSD1306_GRAYSCALE_MAX_LEVELS 4
+#define SSD1306_GRAYSCALE_TASK_STACK 3072
+
+/**
+ * @brief SSD1306 grayscale modulation type
+ *
+ * This enumeration defines how the bit-planes of a grayscale frame are cycled.
+ *
+ * - SSD1306_GRAYSCALE_FRC: One thermometer coded plane per level above black, all shown at the same contrast. A pixel of
+ *   level L is lit during L of the (levels - 1) subframes.
+ * - SSD1306_GRAYSCALE_CONTRAST: One binary weighted plane per bit of the level, each shown with a contrast proportional to its
+ *   weight. Needs fewer subframes per cycle than FRC, so flicker is lower for the same bus throughput.
+ */
+typedef enum
+{
+    SSD1306_GRAYSCALE_FRC,
+    SSD1306_GRAYSCALE_CONTRAST
+} ssd1306_grayscale_mode_t;
+
+/**
+ * @brief SSD1306 grayscale timing statistics type
+ *
+ * This structure stores the timing instrumentation of the grayscale scheduler. Times are in microseconds.
+ */
+typedef struct
+{
+    uint32_t subframes;
+    uint32_t overruns;
+    uint32_t transfer_bytes;
+    int64_t min_interval_us;
+    int64_t max_interval_us;
+    int64_t total_interval_us;
+    int64_t max_transfer_us;
+    int64_t total_transfer_us;
+} ssd1306_grayscale_stats_t;
+
+/**
+ * @brief I2C SSD1306 grayscale handle type
+ *
+ * This structure stores the bit-planes of a grayscale frame and the state of the subframe scheduler.
+ */
+typedef struct
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306;
+    ssd1306_grayscale_mode_t mode;
+    uint8_t levels;
+    uint8_t total_planes;
+    uint8_t current_plane;
+    uint8_t contrast;
+    uint16_t plane_size;
+    uint8_t *planes;
+    uint8_t *ram;
+    esp_timer_handle_t timer;
+    TaskHandle_t task;
+    SemaphoreHandle_t stopped;
+    volatile bool running;
+    int64_t last_subframe_us;
+    ssd1306_grayscale_stats_t stats;
+} i2c_ssd1306_grayscale_handle_t;
+
+esp_err_t i2c_ssd1306_grayscale_init(i2c_ssd1306_grayscale_handle_t *grayscale, i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t levels, ssd1306_grayscale_mode_t mode, uint8_t contrast);
+void i2c_ssd1306_grayscale_deinit(i2c_ssd1306_grayscale_handle_t *grayscale);
+void i2c_ssd1306_grayscale_clear(i2c_ssd1306_grayscale_handle_t *grayscale);
+void i2c_ssd1306_grayscale_fill_pixel(i2c_ssd1306_grayscale_handle_t *grayscale, uint8_t x, uint8_t y, uint8_t level);
+void i2c_ssd1306_grayscale_fill_space(i2c_ssd1306_grayscale_handle_t *grayscale, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint8_t level);
+void i2c_ssd1306_grayscale_load_buffer(i2c_ssd1306_grayscale_handle_t *grayscale, uint8_t level);
+esp_err_t i2c_ssd1306_grayscale_subframe(i2c_ssd1306_grayscale_handle_t *grayscale);
+esp_err_t i2c_ssd1306_grayscale_start(i2c_ssd1306_grayscale_handle_t *grayscale, uint32_t subframe_hz, UBaseType_t task_priority);
+esp_err_t i2c_ssd1306_grayscale_stop(i2c_ssd1306_grayscale_handle_t *grayscale);
+void i2c_ssd1306_grayscale_get_stats(i2c_ssd1306_grayscale_handle_t *grayscale, ssd1306_grayscale_stats_t *stats);
+void i2c_ssd1306_grayscale_reset_stats(i2c_ssd1306_grayscale_handle_t *grayscale);
+void i2c_ssd1306_grayscale_print_stats(i2c_ssd1306_grayscale_handle_t *grayscale);
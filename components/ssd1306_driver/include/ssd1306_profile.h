@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+#define SSD1306_PROFILE_TAG "SSD1306 Profile"
+
+/**
+ * @brief SSD1306 profile entry type
+ *
+ * This structure stores the timing of one profiled function. Times include the functions it calls, in CPU cycles on the target
+ * and in nanoseconds on the host.
+ *
+ * - name: Name of the function.
+ * - calls: Number of calls.
+ * - total_cycles: Sum of the time of all calls.
+ * - max_cycles: Time of the slowest call.
+ * - next: Next profiled function, in order of first call.
+ */
+typedef struct ssd1306_profile_entry
+{
+    const char *name;
+    uint32_t calls;
+    uint64_t total_cycles;
+    uint32_t max_cycles;
+    struct ssd1306_profile_entry *next;
+} ssd1306_profile_entry_t;
+
+#ifdef CONFIG_SSD1306_PROFILING
+
+/**
+ * @brief SSD1306 profile scope type
+ *
+ * This structure stores a call in progress. It is released when the profiled function returns, whatever the return path.
+ */
+typedef struct
+{
+    ssd1306_profile_entry_t *entry;
+    uint32_t start;
+} ssd1306_profile_scope_t;
+
+uint32_t i2c_ssd1306_profile_cycles(void);
+void i2c_ssd1306_profile_end(ssd1306_profile_scope_t *scope);
+
+/* Times the enclosing function from this point until it returns. */
+#define SSD1306_PROFILE()                                                      \
+    static ssd1306_profile_entry_t ssd1306_profile_entry = {.name = __func__}; \
+    ssd1306_profile_scope_t ssd1306_profile_scope __attribute__((cleanup(i2c_ssd1306_profile_end))) = {&ssd1306_profile_entry, i2c_ssd1306_profile_cycles()}
+
+const ssd1306_profile_entry_t *i2c_ssd1306_profile_entries(void);
+void i2c_ssd1306_profile_report(void);
+void i2c_ssd1306_profile_reset(void);
+
+#else
+
+#define SSD1306_PROFILE()
+
+static inline const ssd1306_profile_entry_t *i2c_ssd1306_profile_entries(void) { return NULL; }
+static inline void i2c_ssd1306_profile_report(void) {}
+static inline void i2c_ssd1306_profile_reset(void) {}
+
+#endif
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "esp_err.h"
+#include "esp_log.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* The bus implementations need ESP-IDF, the interface and the mock transport also build on a host. */
+#ifdef ESP_PLATFORM
+#include <driver/i2c_master.h>
+#include <driver/spi_master.h>
+#include "freertos/FreeRTOS.h"
+#endif
+
+#define SSD1306_TRANSPORT_TAG "SSD1306 Transport"
+
+#define I2C_MASTER_TIMEOUT_MS 1000
+
+#define SSD1306_TRANSPORT_MAX_CMD 16 // Maximum number of address command bytes sent in front of a data write.
+#define SSD1306_SPI_QUEUE_SIZE 8     // Number of data writes the SPI transport keeps in flight.
+#define SSD1306_SPI_MAX_SPEED_HZ 10000000
+
+/**
+ * @brief SSD1306 transport type
+ *
+ * This structure is the interface every bus implementation of the SSD1306 driver provides. Command bytes are passed without
+ * any control byte, each implementation frames them for its own bus.
+ *
+ * - write_cmd: Sends command bytes.
+ * - write_data: Sends address command bytes followed by bytes for the RAM, and returns once they are sent.
+ * - write_data_async: Same as write_data, but may return before the bytes are sent. The command bytes are copied, the data
+ *   bytes must stay unchanged until wait returns.
+ * - wait: Waits until every asynchronous write has been sent.
+ * - del: Releases the transport.
+ *
+ * A mock implementation only needs to fill these function pointers, which makes the driver usable without any hardware. The
+ * one created by ssd1306_transport_new_mock() records every write.
+ */
+typedef struct ssd1306_transport ssd1306_transport_t;
+
+struct ssd1306_transport
+{
+    esp_err_t (*write_cmd)(ssd1306_transport_t *transport, const uint8_t *cmd, size_t size);
+    esp_err_t (*write_data)(ssd1306_transport_t *transport, const uint8_t *cmd, size_t cmd_size, const uint8_t *data, size_t size);
+    esp_err_t (*write_data_async)(ssd1306_transport_t *transport, const uint8_t *cmd, size_t cmd_size, const uint8_t *data, size_t size);
+    esp_err_t (*wait)(ssd1306_transport_t *transport);
+    void (*del)(ssd1306_transport_t *transport);
+};
+
+#ifdef ESP_PLATFORM
+
+/**
+ * @brief SSD1306 SPI transport configuration type
+ *
+ * This structure stores the configuration of a 4-wire SPI SSD1306 device. The SPI bus must be initialized beforehand with
+ * spi_bus_initialize(), with DMA enabled to get asynchronous writes.
+ *
+ * - spi_host: SPI host of the initialized bus.
+ * - cs_io_num: Chip select GPIO.
+ * - dc_io_num: Data / command GPIO.
+ * - rst_io_num: Reset GPIO, -1 if not connected.
+ * - clock_speed_hz: SPI clock in Hz, maximum is 10MHz.
+ */
+typedef struct
+{
+    spi_host_device_t spi_host;
+    int cs_io_num;
+    int dc_io_num;
+    int rst_io_num;
+    uint32_t clock_speed_hz;
+} ssd1306_spi_config_t;
+
+esp_err_t ssd1306_transport_new_i2c(i2c_master_bus_handle_t i2c_master_bus, uint8_t i2c_addr, uint32_t i2c_scl_speed_hz, ssd1306_transport_t **transport);
+esp_err_t ssd1306_transport_new_spi(const ssd1306_spi_config_t *config, ssd1306_transport_t **transport);
+
+#endif
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "ssd1306_transport.h"
+#include <stdbool.h>
+
+/**
+ * @brief SSD1306 mock write type
+ *
+ * This structure stores one write received by the mock transport. The bytes of every write are stored one after the other in
+ * the 'bytes' array of the mock transport, the address command bytes first.
+ *
+ * - data: true for write_data and write_data_async, false for write_cmd.
+ * - offset: Position of the first byte of the write in the 'bytes' array.
+ * - cmd_size: Number of command bytes, the address commands in front of the data for a data write.
+ * - size: Number of data bytes, 0 for write_cmd.
+ */
+typedef struct
+{
+    bool data;
+    size_t offset;
+    size_t cmd_size;
+    size_t size;
+} ssd1306_mock_write_t;
+
+/**
+ * @brief SSD1306 mock transport type
+ *
+ * This structure stores every write sent to the mock transport, so tests can check the exact bytes the driver sends without
+ * any hardware. Asynchronous writes are recorded immediately.
+ *
+ * - base: Transport interface, passed to i2c_ssd1306_init_transport().
+ * - writes: Recorded writes, in order.
+ * - total_writes: Number of recorded writes.
+ * - bytes: Recorded bytes of every write.
+ * - total_bytes: Number of recorded bytes.
+ * - error: Returned by every write instead of recording it when not ESP_OK, to test error paths.
+ */
+typedef struct
+{
+    ssd1306_transport_t base;
+    ssd1306_mock_write_t *writes;
+    size_t total_writes;
+    size_t writes_capacity;
+    uint8_t *bytes;
+    size_t total_bytes;
+    size_t bytes_capacity;
+    esp_err_t error;
+} ssd1306_mock_transport_t;
+
+esp_err_t ssd1306_transport_new_mock(ssd1306_transport_t **transport);
+void ssd1306_transport_mock_clear(ssd1306_transport_t *transport);
@@ -0,0 +1,409 @@
+#include "ssd1306_compositor.h"
+
+/**
+ * @brief SSD1306 compositor area type
+ *
+ * This structure stores a rectangle of the display in columns and whole pages.
+ */
+typedef struct
+{
+    uint8_t x1;
+    uint8_t x2;
+    uint8_t initial_page;
+    uint8_t final_page;
+} ssd1306_compositor_area_t;
+
+/**
+ * @brief Get the area of the display covered by a sprite
+ *
+ * @param compositor Pointer to the I2C SSD1306 compositor handle.
+ * @param sprite Pointer to the sprite.
+ * @param x X coordinate of the sprite.
+ * @param y Y coordinate of the sprite.
+ * @param area Pointer to the area that receives the covered columns and pages.
+ *
+ * @return true if any pixel of the sprite is on the display.
+ */
+static bool i2c_ssd1306_compositor_sprite_area(i2c_ssd1306_compositor_handle_t *compositor, const ssd1306_sprite_t *sprite, int16_t x, int16_t y, ssd1306_compositor_area_t *area)
+{
+    int16_t x1 = x < 0 ? 0 : x;
+    int16_t x2 = x + sprite->width - 1;
+    int16_t y1 = y < 0 ? 0 : y;
+    int16_t y2 = y + sprite->height - 1;
+    if (x2 >= compositor->width)
+        x2 = compositor->width - 1;
+    if (y2 >= compositor->total_pages * 8)
+        y2 = compositor->total_pages * 8 - 1;
+    if (x1 > x2 || y1 > y2)
+        return false;
+
+    area->x1 = x1;
+    area->x2 = x2;
+    area->initial_page = y1 / 8;
+    area->final_page = y2 / 8;
+    return true;
+}
+
+/**
+ * @brief Get 8 rows of a column of a sprite image or mask
+ *
+ * This function gathers rows 'row' to 'row + 7' of a column from the page layout, across two pages when 'row' is not a
+ * multiple of 8. Rows outside the sprite read as clear, so with a NULL mask the result covers exactly the rows of the sprite.
+ *
+ * @param bits Image or mask of the sprite, NULL for a fully set mask.
+ * @param sprite Pointer to the sprite.
+ * @param column Column of the sprite.
+ * @param row First row, may be negative.
+ *
+ * @return The 8 rows, first row in the least significant bit.
+ */
+static uint8_t i2c_ssd1306_compositor_sprite_column(const uint8_t *bits, const ssd1306_sprite_t *sprite, uint8_t column, int16_t row)
+{
+    int16_t page = row >= 0 ? row / 8 : (row - 7) / 8;
+    uint8_t shift = row - page * 8;
+    int16_t total_pages = (sprite->height + 7) / 8;
+    uint8_t value = 0xFF;
+    if (bits != NULL)
+    {
+        value = 0;
+        if (page >= 0 && page < total_pages)
+            value = bits[page * sprite->width + column] >> shift;
+        if (shift != 0 && page + 1 >= 0 && page + 1 < total_pages)
+            value |= bits[(page + 1) * sprite->width + column] << (8 - shift);
+    }
+
+    int16_t first = row < 0 ? -row : 0;
+    int16_t last = sprite->height - row;
+    if (last > 8)
+        last = 8;
+    if (first >= last)
+        return 0;
+    return value & (uint8_t)((0xFF << first) & (0xFF >> (8 - last)));
+}
+
+/**
+ * @brief Redraw an area of the display
+ *
+ * This function restores the background of the area, draws the visible sprites over it in index order, clipped to the area,
+ * and queues the area for transfer.
+ *
+ * @param compositor Pointer to the I2C SSD1306 compositor handle.
+ * @param area Pointer to the area.
+ */
+static void i2c_ssd1306_compositor_compose(i2c_ssd1306_compositor_handle_t *compositor, const ssd1306_compositor_area_t *area)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = compositor->i2c_ssd1306;
+    uint8_t size = area->x2 - area->x1 + 1;
+    for (uint8_t page = area->initial_page; page <= area->final_page; page++)
+    {
+        memcpy(&i2c_ssd1306->page[page].segment[area->x1], &compositor->background[page * compositor->width + area->x1], size);
+    }
+
+    for (uint8_t i = 0; i < compositor->total_sprites; i++)
+    {
+        const ssd1306_sprite_t *sprite = &compositor->sprite[i];
+        ssd1306_compositor_area_t sprite_area;
+        if (!sprite->visible || !i2c_ssd1306_compositor_sprite_area(compositor, sprite, sprite->x, sprite->y, &sprite_area))
+            continue;
+
+        uint8_t x1 = sprite_area.x1 > area->x1 ? sprite_area.x1 : area->x1;
+        uint8_t x2 = sprite_area.x2 < area->x2 ? sprite_area.x2 : area->x2;
+        uint8_t initial_page = sprite_area.initial_page > area->initial_page ? sprite_area.initial_page : area->initial_page;
+        uint8_t final_page = sprite_area.final_page < area->final_page ? sprite_area.final_page : area->final_page;
+        if (x1 > x2 || initial_page > final_page)
+            continue;
+
+        for (uint8_t page = initial_page; page <= final_page; page++)
+        {
+            int16_t row = page * 8 - sprite->y;
+            uint8_t *segment = i2c_ssd1306->page[page].segment;
+            for (uint8_t x = x1; x <= x2; x++)
+            {
+                uint8_t column = x - sprite->x;
+                uint8_t mask = i2c_ssd1306_compositor_sprite_column(sprite->mask, sprite, column, row);
+                if (mask == 0)
+                    continue;
+
+                uint8_t value = i2c_ssd1306_compositor_sprite_column(sprite->image, sprite, column, row);
+                if (sprite->invert)
+                    value = ~value;
+                segment[x] = (segment[x] & ~mask) | (value & mask);
+            }
+        }
+    }
+
+    for (uint8_t page = area->initial_page; page <= area->final_page; page++)
+    {
+        i2c_ssd1306_queue_segments(i2c_ssd1306, page, area->x1, area->x2);
+    }
+}
+
+/**
+ * @brief Merge two areas if they overlap or touch
+ *
+ * @param area Pointer to the area that grows to cover both areas.
+ * @param other Pointer to the other area.
+ *
+ * @return true if the areas were merged.
+ */
+static bool i2c_ssd1306_compositor_merge(ssd1306_compositor_area_t *area, const ssd1306_compositor_area_t *other)
+{
+    if (other->x1 > area->x2 + 1 || area->x1 > other->x2 + 1 || other->initial_page > area->final_page + 1 || area->initial_page > other->final_page + 1)
+        return false;
+
+    if (other->x1 < area->x1)
+        area->x1 = other->x1;
+    if (other->x2 > area->x2)
+        area->x2 = other->x2;
+    if (other->initial_page < area->initial_page)
+        area->initial_page = other->initial_page;
+    if (other->final_page > area->final_page)
+        area->final_page = other->final_page;
+    return true;
+}
+
+/**
+ * @brief Initialize the I2C SSD1306 compositor
+ *
+ * This function attaches a sprite compositor to an initialized SSD1306 handle. The current buffer becomes the background, and
+ * the first flush sends the whole frame.
+ *
+ * @param compositor Pointer to the I2C SSD1306 compositor handle.
+ * @param i2c_ssd1306 Pointer to an initialized I2C SSD1306 handle.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_NO_MEM Memory allocation failed
+ */
+esp_err_t i2c_ssd1306_compositor_init(i2c_ssd1306_compositor_handle_t *compositor, i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    memset(compositor, 0, sizeof(i2c_ssd1306_compositor_handle_t));
+    compositor->i2c_ssd1306 = i2c_ssd1306;
+    compositor->width = i2c_ssd1306->width;
+    compositor->total_pages = i2c_ssd1306->total_pages;
+    compositor->background = (uint8_t *)malloc(compositor->total_pages * compositor->width);
+    if (compositor->background == NULL)
+        return ESP_ERR_NO_MEM;
+
+    i2c_ssd1306_compositor_set_background(compositor);
+    return ESP_OK;
+}
+
+/**
+ * @brief Release the I2C SSD1306 compositor
+ *
+ * @param compositor Pointer to the I2C SSD1306 compositor handle.
+ */
+void i2c_ssd1306_compositor_deinit(i2c_ssd1306_compositor_handle_t *compositor)
+{
+    free(compositor->background);
+    compositor->background = NULL;
+}
+
+/**
+ * @brief Take the buffer as the new background
+ *
+ * This function copies the buffer into the background, so the buffer must hold the background alone, without sprites. Draw it
+ * after i2c_ssd1306_buffer_clear() and before this call. The next flush sends the whole frame.
+ *
+ * @param compositor Pointer to the I2C SSD1306 compositor handle.
+ */
+void i2c_ssd1306_compositor_set_background(i2c_ssd1306_compositor_handle_t *compositor)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = compositor->i2c_ssd1306;
+    if (i2c_ssd1306->width != compositor->width || i2c_ssd1306->total_pages != compositor->total_pages)
+    {
+        ESP_LOGE(SSD1306_COMPOSITOR_TAG, "Buffer size changed, the compositor must be initialized again");
+        return;
+    }
+
+    for (uint8_t i = 0; i < compositor->total_pages; i++)
+    {
+        memcpy(&compositor->background[i * compositor->width], i2c_ssd1306->page[i].segment, compositor->width);
+    }
+    compositor->background_dirty = true;
+}
+
+/**
+ * @brief Add a sprite to the compositor
+ *
+ * The image and the mask are not copied and must stay valid while the sprite exists. The sprite is visible and on top of the
+ * sprites added before it.
+ *
+ * @param compositor Pointer to the I2C SSD1306 compositor handle.
+ * @param image Pixels of the sprite, in the page layout of i2c_ssd1306_buffer_image().
+ * @param mask Pixels of the sprite that cover the layers below, in the same layout, NULL to cover its whole bounding box.
+ * @param width Width of the sprite.
+ * @param height Height of the sprite.
+ * @param x X coordinate of the sprite.
+ * @param y Y coordinate of the sprite.
+ * @param sprite_id Pointer that receives the identifier of the sprite.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Invalid argument
+ *     - ESP_ERR_NO_MEM No free sprite
+ */
+esp_err_t i2c_ssd1306_compositor_add_sprite(i2c_ssd1306_compositor_handle_t *compositor, const uint8_t *image, const uint8_t *mask, uint8_t width, uint8_t height, int16_t x, int16_t y, uint8_t *sprite_id)
+{
+    if (image == NULL || width == 0 || height == 0)
+    {
+        ESP_LOGE(SSD1306_COMPOSITOR_TAG, "Invalid sprite image");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (compositor->total_sprites >= SSD1306_COMPOSITOR_MAX_SPRITES)
+    {
+        ESP_LOGE(SSD1306_COMPOSITOR_TAG, "No free sprite, maximum is %d", SSD1306_COMPOSITOR_MAX_SPRITES);
+        return ESP_ERR_NO_MEM;
+    }
+
+    ssd1306_sprite_t *sprite = &compositor->sprite[compositor->total_sprites];
+    memset(sprite, 0, sizeof(ssd1306_sprite_t));
+    sprite->image = image;
+    sprite->mask = mask;
+    sprite->width = width;
+    sprite->height = height;
+    sprite->x = x;
+    sprite->y = y;
+    sprite->visible = true;
+    sprite->dirty = true;
+    *sprite_id = compositor->total_sprites++;
+    return ESP_OK;
+}
+
+/**
+ * @brief Move a sprite
+ *
+ * @param compositor Pointer to the I2C SSD1306 compositor handle.
+ * @param sprite_id Identifier of the sprite.
+ * @param x New X coordinate of the sprite.
+ * @param y New Y coordinate of the sprite.
+ */
+void i2c_ssd1306_compositor_move_sprite(i2c_ssd1306_compositor_handle_t *compositor, uint8_t sprite_id, int16_t x, int16_t y)
+{
+    if (sprite_id >= compositor->total_sprites)
+    {
+        ESP_LOGE(SSD1306_COMPOSITOR_TAG, "Invalid sprite %d", sprite_id);
+        return;
+    }
+
+    ssd1306_sprite_t *sprite = &compositor->sprite[sprite_id];
+    if (sprite->x == x && sprite->y == y)
+        return;
+    sprite->x = x;
+    sprite->y = y;
+    sprite->dirty = true;
+}
+
+/**
+ * @brief Show or hide a sprite
+ *
+ * @param compositor Pointer to the I2C SSD1306 compositor handle.
+ * @param sprite_id Identifier of the sprite.
+ * @param visible Show the sprite if true, hide it if false.
+ */
+void i2c_ssd1306_compositor_show_sprite(i2c_ssd1306_compositor_handle_t *compositor, uint8_t sprite_id, bool visible)
+{
+    if (sprite_id >= compositor->total_sprites)
+    {
+        ESP_LOGE(SSD1306_COMPOSITOR_TAG, "Invalid sprite %d", sprite_id);
+        return;
+    }
+
+    ssd1306_sprite_t *sprite = &compositor->sprite[sprite_id];
+    if (sprite->visible == visible)
+        return;
+    sprite->visible = visible;
+    sprite->dirty = true;
+}
+
+/**
+ * @brief Change the image of a sprite
+ *
+ * The new image and mask keep the width and height of the sprite, as for animation frames.
+ *
+ * @param compositor Pointer to the I2C SSD1306 compositor handle.
+ * @param sprite_id Identifier of the sprite.
+ * @param image New pixels of the sprite.
+ * @param mask New mask of the sprite, NULL to cover its whole bounding box.
+ * @param invert Invert the pixels of the sprite if true.
+ */
+void i2c_ssd1306_compositor_set_sprite_image(i2c_ssd1306_compositor_handle_t *compositor, uint8_t sprite_id, const uint8_t *image, const uint8_t *mask, bool invert)
+{
+    if (sprite_id >= compositor->total_sprites || image == NULL)
+    {
+        ESP_LOGE(SSD1306_COMPOSITOR_TAG, "Invalid sprite %d", sprite_id);
+        return;
+    }
+
+    ssd1306_sprite_t *sprite = &compositor->sprite[sprite_id];
+    sprite->image = image;
+    sprite->mask = mask;
+    sprite->invert = invert;
+    sprite->dirty = true;
+}
+
+/**
+ * @brief Transfer the changes of the sprites to the RAM of the SSD1306 device
+ *
+ * This function redraws only the areas where a sprite was and where it is now, restoring the background and drawing every
+ * sprite that overlaps them, and queues those areas so that nearby spans share a transmission. Sprites that did not change
+ * cost nothing. After a new background the whole frame is redrawn.
+ *
+ * @param compositor Pointer to the I2C SSD1306 compositor handle.
+ *
+ * @return Number of transmissions used.
+ */
+uint16_t i2c_ssd1306_compositor_flush(i2c_ssd1306_compositor_handle_t *compositor)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = compositor->i2c_ssd1306;
+    if (i2c_ssd1306->width != compositor->width || i2c_ssd1306->total_pages != compositor->total_pages)
+    {
+        ESP_LOGE(SSD1306_COMPOSITOR_TAG, "Buffer size changed, the compositor must be initialized again");
+        return 0;
+    }
+
+    ssd1306_compositor_area_t area[2 * SSD1306_COMPOSITOR_MAX_SPRITES];
+    uint8_t total_areas = 0;
+    bool full_frame = compositor->background_dirty;
+    if (full_frame)
+    {
+        area[0].x1 = 0;
+        area[0].x2 = compositor->width - 1;
+        area[0].initial_page = 0;
+        area[0].final_page = compositor->total_pages - 1;
+        total_areas = 1;
+        compositor->background_dirty = false;
+    }
+
+    for (uint8_t i = 0; i < compositor->total_sprites; i++)
+    {
+        ssd1306_sprite_t *sprite = &compositor->sprite[i];
+        if (!sprite->dirty)
+            continue;
+
+        ssd1306_compositor_area_t old_area, new_area;
+        bool has_old = sprite->drawn && i2c_ssd1306_compositor_sprite_area(compositor, sprite, sprite->drawn_x, sprite->drawn_y, &old_area);
+        bool has_new = sprite->visible && i2c_ssd1306_compositor_sprite_area(compositor, sprite, sprite->x, sprite->y, &new_area);
+        if (has_old && has_new && i2c_ssd1306_compositor_merge(&new_area, &old_area))
+            has_old = false;
+        if (!full_frame)
+        {
+            if (has_old)
+                area[total_areas++] = old_area;
+            if (has_new)
+                area[total_areas++] = new_area;
+        }
+
+        sprite->drawn = sprite->visible;
+        sprite->drawn_x = sprite->x;
+        sprite->drawn_y = sprite->y;
+        sprite->dirty = false;
+    }
+
+    for (uint8_t i = 0; i < total_areas; i++)
+    {
+        i2c_ssd1306_compositor_compose(compositor, &area[i]);
+    }
+    return i2c_ssd1306_queue_flush(i2c_ssd1306);
+}
@@ -0,0 +1,146 @@
+#include "ssd1306_controller.h"
+#include "ssd1306_cmd.h"
+#include <string.h>
+
+static uint8_t ssd1306_init_cmd(uint8_t *cmd, uint8_t height)
+{
+    const uint8_t init_cmd[] = {
+        OLED_CMD_DISPLAY_OFF,
+        OLED_CMD_SET_MUX_RATIO, (height - 1),
+        OLED_CMD_SET_VERT_DISPLAY_OFFSET, 0x00,
+        OLED_MASK_DISPLAY_START_LINE | 0x00,
+        OLED_CMD_SET_COM_PIN_HARDWARE_MAP, 0x12,
+        OLED_CMD_SET_MEMORY_ADDR_MODE, 0x02,
+        OLED_CMD_SET_CONTRAST_CONTROL, 0xFF,
+        OLED_CMD_SET_DISPLAY_CLK_DIVIDE, 0x80,
+        OLED_CMD_ENABLE_DISPLAY_RAM,
+        OLED_CMD_NORMAL_DISPLAY,
+        OLED_CMD_SET_CHARGE_PUMP, 0x14};
+    memcpy(cmd, init_cmd, sizeof(init_cmd));
+    return sizeof(init_cmd);
+}
+
+/* The SSD1309 runs from an external VCC, so it has no charge pump and needs its own pre-charge and VCOMH levels. */
+static uint8_t ssd1309_init_cmd(uint8_t *cmd, uint8_t height)
+{
+    const uint8_t init_cmd[] = {
+        OLED_CMD_DISPLAY_OFF,
+        OLED_CMD_SET_DISPLAY_CLK_DIVIDE, 0xA0,
+        OLED_CMD_SET_MUX_RATIO, (height - 1),
+        OLED_CMD_SET_VERT_DISPLAY_OFFSET, 0x00,
+        OLED_MASK_DISPLAY_START_LINE | 0x00,
+        OLED_CMD_SET_COM_PIN_HARDWARE_MAP, 0x12,
+        OLED_CMD_SET_MEMORY_ADDR_MODE, 0x02,
+        OLED_CMD_SET_CONTRAST_CONTROL, 0xFF,
+        OLED_CMD_SET_PRECHARGE_PERIOD, 0x82,
+        OLED_CMD_SET_VCOMH_DESELECT_LEVEL, 0x34,
+        OLED_CMD_ENABLE_DISPLAY_RAM,
+        OLED_CMD_NORMAL_DISPLAY};
+    memcpy(cmd, init_cmd, sizeof(init_cmd));
+    return sizeof(init_cmd);
+}
+
+static uint8_t sh1106_init_cmd(uint8_t *cmd, uint8_t height)
+{
+    const uint8_t init_cmd[] = {
+        OLED_CMD_DISPLAY_OFF,
+        OLED_CMD_SET_DISPLAY_CLK_DIVIDE, 0x80,
+        OLED_CMD_SET_MUX_RATIO, (height - 1),
+        OLED_CMD_SET_VERT_DISPLAY_OFFSET, 0x00,
+        OLED_MASK_DISPLAY_START_LINE | 0x00,
+        OLED_CMD_SET_COM_PIN_HARDWARE_MAP, 0x12,
+        OLED_CMD_SET_CONTRAST_CONTROL, 0xFF,
+        OLED_CMD_SET_PRECHARGE_PERIOD, 0x1F,
+        OLED_CMD_SET_VCOMH_DESELECT_LEVEL, 0x40,
+        OLED_CMD_ENABLE_DISPLAY_RAM,
+        OLED_CMD_NORMAL_DISPLAY,
+        SH1106_CMD_SET_DCDC_CONTROL, 0x8B};
+    memcpy(cmd, init_cmd, sizeof(init_cmd));
+    return sizeof(init_cmd);
+}
+
+static uint8_t ssd1306_remap_cmd(uint8_t *cmd, bool flip_segment, bool flip_com)
+{
+    cmd[0] = flip_segment ? OLED_CMD_SEGMENT_REMAP_RIGHT_TO_LEFT : OLED_CMD_SEGMENT_REMAP_LEFT_TO_RIGHT;
+    cmd[1] = flip_com ? OLED_CMD_COM_SCAN_DIRECTION_REMAP : OLED_CMD_COM_SCAN_DIRECTION_NORMAL;
+    return 2;
+}
+
+static uint8_t ssd1327_init_cmd(uint8_t *cmd, uint8_t height)
+{
+    const uint8_t init_cmd[] = {
+        OLED_CMD_DISPLAY_OFF,
+        SSD1327_CMD_SET_START_LINE, 0x00,
+        SSD1327_CMD_SET_DISPLAY_OFFSET, 0x00,
+        OLED_CMD_SET_MUX_RATIO, (height - 1),
+        SSD1327_CMD_FUNCTION_SELECTION_A, 0x01,
+        SSD1327_CMD_SET_PHASE_LENGTH, 0x51,
+        SSD1327_CMD_SET_CLK_DIVIDE, 0x01,
+        SSD1327_CMD_SET_PRECHARGE_VOLTAGE, 0x08,
+        SSD1327_CMD_SET_VCOMH_VOLTAGE, 0x07,
+        SSD1327_CMD_FUNCTION_SELECTION_B, 0x62,
+        OLED_CMD_SET_CONTRAST_CONTROL, 0xFF,
+        SSD1327_CMD_NORMAL_DISPLAY};
+    memcpy(cmd, init_cmd, sizeof(init_cmd));
+    return sizeof(init_cmd);
+}
+
+/* 128x128 modules are wired with the columns and COM lines reversed, so the unflipped orientation already sets both remaps. */
+static uint8_t ssd1327_remap_cmd(uint8_t *cmd, bool flip_segment, bool flip_com)
+{
+    cmd[0] = SSD1327_CMD_SET_REMAP;
+    cmd[1] = SSD1327_REMAP_COM_SPLIT;
+    if (!flip_segment)
+        cmd[1] |= SSD1327_REMAP_COLUMN;
+    else
+        cmd[1] |= SSD1327_REMAP_NIBBLE;
+    if (!flip_com)
+        cmd[1] |= SSD1327_REMAP_COM;
+    return 2;
+}
+
+const ssd1306_controller_t ssd1306_controller_ssd1306 = {
+    .name = "SSD1306",
+    .max_width = 128,
+    .max_height = 64,
+    .column_offset = 0,
+    .max_transfer = 1024,
+    .addressing = SSD1306_ADDRESSING_HORIZONTAL,
+    .init_cmd = ssd1306_init_cmd,
+    .remap_cmd = ssd1306_remap_cmd,
+};
+
+const ssd1306_controller_t ssd1306_controller_ssd1309 = {
+    .name = "SSD1309",
+    .max_width = 128,
+    .max_height = 64,
+    .column_offset = 0,
+    .max_transfer = 1024,
+    .addressing = SSD1306_ADDRESSING_HORIZONTAL,
+    .init_cmd = ssd1309_init_cmd,
+    .remap_cmd = ssd1306_remap_cmd,
+};
+
+/* 128 column panels are centered in the 132 column RAM of the SH1106. */
+const ssd1306_controller_t ssd1306_controller_sh1106 = {
+    .name = "SH1106",
+    .max_width = 128,
+    .max_height = 64,
+    .column_offset = (SH1106_RAM_WIDTH - 128) / 2,
+    .max_transfer = SH1106_RAM_WIDTH,
+    .addressing = SSD1306_ADDRESSING_PAGE,
+    .init_cmd = sh1106_init_cmd,
+    .remap_cmd = ssd1306_remap_cmd,
+};
+
+/* A 128x128 frame expands to 128 rows of 64 bytes, sent in a single write. */
+const ssd1306_controller_t ssd1306_controller_ssd1327 = {
+    .name = "SSD1327",
+    .max_width = 128,
+    .max_height = 128,
+    .column_offset = 0,
+    .max_transfer = 8192,
+    .addressing = SSD1306_ADDRESSING_GRAY4,
+    .init_cmd = ssd1327_init_cmd,
+    .remap_cmd = ssd1327_remap_cmd,
+};
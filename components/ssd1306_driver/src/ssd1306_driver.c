@@ -1,5 +1,143 @@
 #include "ssd1306_driver.h"
 #include "ssd1306_cmd.h"
+#include "ssd1306_font.h"
+
+/**
+ * @brief Free the buffer of the SSD1306 device
+ *
+ * This function frees the pages and the queue, if any, and leaves the handle with an empty buffer.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ */
+static void i2c_ssd1306_buffer_free(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    if (i2c_ssd1306->page != NULL)
+        free(i2c_ssd1306->page[0].segment);
+    free(i2c_ssd1306->page);
+    free(i2c_ssd1306->queue);
+
+    i2c_ssd1306->page = NULL;
+    i2c_ssd1306->queue = NULL;
+    i2c_ssd1306->width = 0;
+    i2c_ssd1306->height = 0;
+    i2c_ssd1306->total_pages = 0;
+}
+
+/**
+ * @brief Allocate the buffer of the SSD1306 device
+ *
+ * This function frees the current buffer, if any, and allocates a cleared buffer of the given size, all pages in one block. If
+ * the allocation fails the handle is left with an empty buffer, 'page' is NULL and 'total_pages' is 0.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ * @param width Width of the buffer.
+ * @param height Height of the buffer, multiple of 8.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_NO_MEM Memory allocation failed
+ */
+static esp_err_t i2c_ssd1306_buffer_alloc(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t width, uint8_t height)
+{
+    i2c_ssd1306_buffer_free(i2c_ssd1306);
+
+    uint8_t total_pages = height / 8;
+    ssd1306_page_t *page = (ssd1306_page_t *)calloc(total_pages, sizeof(ssd1306_page_t));
+    ssd1306_queue_page_t *queue = (ssd1306_queue_page_t *)calloc(total_pages, sizeof(ssd1306_queue_page_t));
+    /* The pages are one block, so consecutive pages can be sent to the RAM in a single write. */
+    uint8_t *segment = (uint8_t *)calloc(total_pages * width, sizeof(uint8_t));
+    if (page == NULL || queue == NULL || segment == NULL)
+    {
+        free(page);
+        free(queue);
+        free(segment);
+        return ESP_ERR_NO_MEM;
+    }
+
+    for (uint8_t i = 0; i < total_pages; i++)
+    {
+        page[i].segment = &segment[i * width];
+    }
+
+    i2c_ssd1306->page = page;
+    i2c_ssd1306->queue = queue;
+    i2c_ssd1306->width = width;
+    i2c_ssd1306->height = height;
+    i2c_ssd1306->total_pages = total_pages;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Initialize the SSD1306 driver device over a transport
+ *
+ * This function sends the initialization sequence of the controller through an already created transport and allocates the
+ * buffer. The handle takes ownership of the transport, which is released by i2c_ssd1306_deinit().
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ * @param transport Transport the device is connected through.
+ * @param controller Controller of the device, such as ssd1306_controller_ssd1306 or ssd1306_controller_sh1106.
+ * @param width Width of the display, maximum given by the controller.
+ * @param height Height of the display, from 16 to the maximum given by the controller, multiple of 8.
+ * @param wise Wise of the display.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Invalid argument
+ *     - ESP_ERR_NO_MEM Memory allocation failed
+ *     - ESP_FAIL Failed
+ */
+esp_err_t i2c_ssd1306_init_transport(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_transport_t *transport, const ssd1306_controller_t *controller, uint8_t width, uint8_t height, ssd1306_wise_t wise)
+{
+    SSD1306_PROFILE();
+    i2c_ssd1306->transport = transport;
+    i2c_ssd1306->page = NULL;
+    i2c_ssd1306->queue = NULL;
+    i2c_ssd1306->total_pages = 0;
+    i2c_ssd1306->gray = NULL;
+
+    if (width == 0 || width > controller->max_width || height < 16 || height > controller->max_height || height % 8 != 0)
+        return ESP_ERR_INVALID_ARG;
+    if (controller->addressing == SSD1306_ADDRESSING_GRAY4 && width % 2 != 0)
+        return ESP_ERR_INVALID_ARG;
+
+    esp_err_t ret;
+    uint8_t init_cmd[SSD1306_CONTROLLER_MAX_INIT_CMD];
+    uint8_t size = controller->init_cmd(init_cmd, height);
+    size += controller->remap_cmd(&init_cmd[size], wise == SSD1306_BOTTOM_TO_TOP, wise == SSD1306_BOTTOM_TO_TOP);
+    init_cmd[size++] = OLED_CMD_DISPLAY_ON;
+    ret = transport->write_cmd(transport, init_cmd, size);
+    if (ret != ESP_OK)
+        return ret;
+    else
+        ESP_LOGI(SSD1306_TAG, "%s device initialized successfully", controller->name);
+
+    i2c_ssd1306->controller = controller;
+    i2c_ssd1306->horizontal_mode = false;
+    i2c_ssd1306->panel_width = width;
+    i2c_ssd1306->panel_height = height;
+    i2c_ssd1306->wise = wise;
+    i2c_ssd1306->rotation = SSD1306_ROTATION_0;
+    i2c_ssd1306->mirror_x = false;
+    i2c_ssd1306->mirror_y = false;
+
+    ret = i2c_ssd1306_buffer_alloc(i2c_ssd1306, width, height);
+    if (ret != ESP_OK)
+        return ret;
+    ESP_LOGI(SSD1306_TAG, "SSD1306 page allocated successfully");
+
+    /* Two pixels per byte, the same size for every orientation. */
+    if (controller->addressing == SSD1306_ADDRESSING_GRAY4)
+    {
+        i2c_ssd1306->gray = (uint8_t *)malloc(width * height / 2);
+        if (i2c_ssd1306->gray == NULL)
+            return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
+}
+
+#ifdef ESP_PLATFORM
 
 /**
  * @brief Initialize the I2C SSD1306 driver device
@@ -22,72 +160,175 @@
  */
 esp_err_t i2c_ssd1306_init(i2c_ssd1306_handle_t *i2c_ssd1306, i2c_master_bus_handle_t i2c_master_bus, uint8_t i2c_addr, uint32_t i2c_scl_speed_hz, uint8_t width, uint8_t height, ssd1306_wise_t wise)
 {
+    SSD1306_PROFILE();
     if (i2c_scl_speed_hz > 400000 || width > 128 || height < 16 || height > 64 || height % 8 != 0)
         return ESP_ERR_INVALID_ARG;
 
-    esp_err_t ret;
-    i2c_device_config_t i2c_device_config = {
-        .dev_addr_length = I2C_ADDR_BIT_7,
-        .device_address = i2c_addr,
-        .scl_speed_hz = i2c_scl_speed_hz,
-    };
-    ret = i2c_master_bus_add_device(i2c_master_bus, &i2c_device_config, &i2c_ssd1306->i2c_master_dev);
+    ssd1306_transport_t *transport;
+    esp_err_t ret = ssd1306_transport_new_i2c(i2c_master_bus, i2c_addr, i2c_scl_speed_hz, &transport);
     if (ret != ESP_OK)
         return ret;
-    else
-        ESP_LOGI(SSD1306_TAG, "I2C SSD1306 device added successfully");
-
-    uint8_t ssd1306_init_cmd[] = {
-        OLED_CONTROL_BYTE_CMD,
-        OLED_CMD_DISPLAY_OFF,
-        OLED_CMD_SET_MUX_RATIO, (height - 1),
-        OLED_CMD_SET_VERT_DISPLAY_OFFSET, 0x00,
-        OLED_MASK_DISPLAY_START_LINE | 0x00,
-        0x00,
-        0x00,
-        OLED_CMD_SET_COM_PIN_HARDWARE_MAP, 0x12,
-        OLED_CMD_SET_MEMORY_ADDR_MODE, 0x02,
-        OLED_CMD_SET_CONTRAST_CONTROL, 0xFF,
-        OLED_CMD_SET_DISPLAY_CLK_DIVIDE, 0x80,
-        OLED_CMD_ENABLE_DISPLAY_RAM,
-        OLED_CMD_NORMAL_DISPLAY,
-        OLED_CMD_SET_CHARGE_PUMP, 0x14,
-        OLED_CMD_DISPLAY_ON};
-
-    if (wise == SSD1306_TOP_TO_BOTTOM)
-    {
-        ssd1306_init_cmd[7] = OLED_CMD_COM_SCAN_DIRECTION_NORMAL;
-        ssd1306_init_cmd[8] = OLED_CMD_SEGMENT_REMAP_LEFT_TO_RIGHT;
-    }
-    else if (wise == SSD1306_BOTTOM_TO_TOP)
-    {
-        ssd1306_init_cmd[7] = OLED_CMD_COM_SCAN_DIRECTION_REMAP;
-        ssd1306_init_cmd[8] = OLED_CMD_SEGMENT_REMAP_RIGHT_TO_LEFT;
-    }
-    ret = i2c_master_transmit(i2c_ssd1306->i2c_master_dev, ssd1306_init_cmd, sizeof(ssd1306_init_cmd), I2C_MASTER_TIMEOUT_MS / portTICK_PERIOD_MS);
+
+    ret = i2c_ssd1306_init_transport(i2c_ssd1306, transport, &ssd1306_controller_ssd1306, width, height, wise);
+    if (ret != ESP_OK)
+        i2c_ssd1306_deinit(i2c_ssd1306);
+    return ret;
+}
+
+/**
+ * @brief Initialize the SPI SSD1306 driver device
+ *
+ * This function initializes a 4-wire SPI SSD1306 device. The drawing API is the same as over I2C, but full frames and queued
+ * spans are sent as DMA transactions at up to 10MHz.
+ *
+ * @param i2c_ssd1306 Pointer to the SSD1306 handle.
+ * @param spi_config Pointer to the SPI configuration.
+ * @param width Width of the SSD1306 display, maximum 128.
+ * @param height Height of the SSD1306 display, between 16 and 64, multiple of 8.
+ * @param wise Wise of the SSD1306 display.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Invalid argument
+ *     - ESP_ERR_NO_MEM Memory allocation failed
+ *     - ESP_FAIL Failed
+ */
+esp_err_t i2c_ssd1306_spi_init(i2c_ssd1306_handle_t *i2c_ssd1306, const ssd1306_spi_config_t *spi_config, uint8_t width, uint8_t height, ssd1306_wise_t wise)
+{
+    SSD1306_PROFILE();
+    if (width > 128 || height < 16 || height > 64 || height % 8 != 0)
+        return ESP_ERR_INVALID_ARG;
+
+    ssd1306_transport_t *transport;
+    esp_err_t ret = ssd1306_transport_new_spi(spi_config, &transport);
     if (ret != ESP_OK)
         return ret;
-    else
-        ESP_LOGI(SSD1306_TAG, "I2C SSD1306 device initialized successfully");
 
-    i2c_ssd1306->i2c_addr = i2c_addr;
-    i2c_ssd1306->scl_speed_hz = i2c_scl_speed_hz;
-    i2c_ssd1306->width = width;
-    i2c_ssd1306->height = height;
-    i2c_ssd1306->total_pages = height / 8;
+    ret = i2c_ssd1306_init_transport(i2c_ssd1306, transport, &ssd1306_controller_ssd1306, width, height, wise);
+    if (ret != ESP_OK)
+        i2c_ssd1306_deinit(i2c_ssd1306);
+    return ret;
+}
 
-    i2c_ssd1306->page = (ssd1306_page_t *)calloc(i2c_ssd1306->total_pages, sizeof(ssd1306_page_t));
-    if (i2c_ssd1306->page == NULL)
-        return ESP_ERR_NO_MEM;
+#endif
 
-    for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
+/**
+ * @brief Release the SSD1306 driver device
+ *
+ * This function frees the buffer and the expanded frame, if any, and releases the transport of the handle.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ */
+void i2c_ssd1306_deinit(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    SSD1306_PROFILE();
+    i2c_ssd1306_canvas_deinit(i2c_ssd1306);
+    free(i2c_ssd1306->gray);
+    i2c_ssd1306->gray = NULL;
+    if (i2c_ssd1306->transport != NULL)
     {
-        i2c_ssd1306->page[i].segment = (uint8_t *)calloc(width, sizeof(uint8_t));
-        if (i2c_ssd1306->page[i].segment == NULL)
-            return ESP_ERR_NO_MEM;
+        i2c_ssd1306->transport->del(i2c_ssd1306->transport);
+        i2c_ssd1306->transport = NULL;
+    }
+}
+
+/**
+ * @brief Check if the buffer of the SSD1306 device is transposed relative to the RAM
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ *
+ * @return true if the rotation is 90 or 270 degrees.
+ */
+static inline bool i2c_ssd1306_is_transposed(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    return i2c_ssd1306->rotation == SSD1306_ROTATION_90 || i2c_ssd1306->rotation == SSD1306_ROTATION_270;
+}
+
+/**
+ * @brief Set the orientation of the SSD1306 device
+ *
+ * This function rotates and mirrors the display at runtime without reinitializing it. Mirroring and 180 degree rotation only
+ * change the segment remap and COM scan direction of the SSD1306 device. For 90 and 270 degrees the buffer is reallocated with
+ * width and height swapped and cleared, and the transfer functions transpose it to the RAM an 8x8 block at a time, while the
+ * hardware remap supplies the remaining flip. The buffer is transferred to the RAM afterwards. If the remap command fails
+ * nothing is changed, if the reallocation fails the new orientation is kept with an empty buffer.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ * @param rotation Clockwise rotation relative to the wise given to i2c_ssd1306_init().
+ * @param mirror_x Mirror the X axis of the buffer if true.
+ * @param mirror_y Mirror the Y axis of the buffer if true.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Invalid argument
+ *     - ESP_ERR_NO_MEM Memory allocation failed
+ *     - ESP_FAIL Failed
+ */
+esp_err_t i2c_ssd1306_set_orientation(i2c_ssd1306_handle_t *i2c_ssd1306, ssd1306_rotation_t rotation, bool mirror_x, bool mirror_y)
+{
+    SSD1306_PROFILE();
+    if (rotation > SSD1306_ROTATION_270)
+        return ESP_ERR_INVALID_ARG;
+
+    bool transposed = rotation == SSD1306_ROTATION_90 || rotation == SSD1306_ROTATION_270;
+    if (transposed && i2c_ssd1306->panel_width % 8 != 0)
+        return ESP_ERR_INVALID_ARG;
+
+    bool flip_segment = i2c_ssd1306->wise == SSD1306_BOTTOM_TO_TOP;
+    bool flip_com = i2c_ssd1306->wise == SSD1306_BOTTOM_TO_TOP;
+    if (rotation == SSD1306_ROTATION_90)
+    {
+        flip_segment = !flip_segment;
+    }
+    else if (rotation == SSD1306_ROTATION_180)
+    {
+        flip_segment = !flip_segment;
+        flip_com = !flip_com;
+    }
+    else if (rotation == SSD1306_ROTATION_270)
+    {
+        flip_com = !flip_com;
+    }
+
+    /* When transposed, the X axis of the buffer runs along the COM lines and the Y axis along the segments. */
+    if (mirror_x)
+    {
+        if (transposed)
+            flip_com = !flip_com;
+        else
+            flip_segment = !flip_segment;
+    }
+    if (mirror_y)
+    {
+        if (transposed)
+            flip_segment = !flip_segment;
+        else
+            flip_com = !flip_com;
+    }
+
+    uint8_t remap_cmd[SSD1306_CONTROLLER_MAX_INIT_CMD];
+    uint8_t size = i2c_ssd1306->controller->remap_cmd(remap_cmd, flip_segment, flip_com);
+    esp_err_t ret = i2c_ssd1306->transport->write_cmd(i2c_ssd1306->transport, remap_cmd, size);
+    if (ret != ESP_OK)
+        return ret;
+
+    /* The buffer is only reallocated once the remap is applied, so its dimensions always match the rotation. */
+    bool reallocate = transposed != i2c_ssd1306_is_transposed(i2c_ssd1306);
+    i2c_ssd1306->rotation = rotation;
+    i2c_ssd1306->mirror_x = mirror_x;
+    i2c_ssd1306->mirror_y = mirror_y;
+    if (reallocate)
+    {
+        if (transposed)
+            ret = i2c_ssd1306_buffer_alloc(i2c_ssd1306, i2c_ssd1306->panel_height, i2c_ssd1306->panel_width);
+        else
+            ret = i2c_ssd1306_buffer_alloc(i2c_ssd1306, i2c_ssd1306->panel_width, i2c_ssd1306->panel_height);
+        if (ret != ESP_OK)
+            return ret;
     }
-    ESP_LOGI(SSD1306_TAG, "I2C SSD1306 page allocated successfully");
 
+    /* The segment remap only applies to data written afterwards, so the whole RAM is rewritten. */
+    i2c_ssd1306_pages_to_ram(i2c_ssd1306);
     return ESP_OK;
 }
 
@@ -100,6 +341,7 @@ esp_err_t i2c_ssd1306_init(i2c_ssd1306_handle_t *i2c_ssd1306, i2c_master_bus_han
  */
 void i2c_ssd1306_buffer_check(i2c_ssd1306_handle_t *i2c_ssd1306)
 {
+    SSD1306_PROFILE();
     for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
     {
         for (uint8_t j = 0; j < i2c_ssd1306->width; j++)
@@ -110,6 +352,76 @@ void i2c_ssd1306_buffer_check(i2c_ssd1306_handle_t *i2c_ssd1306)
     }
 }
 
+/**
+ * @brief Print the buffer of the SSD1306 device
+ *
+ * This function prints the buffer of the SSD1306 device as a monochrome image, one character per pixel, the same way
+ * print_array() of the image converter does.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ */
+void i2c_ssd1306_buffer_print(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    SSD1306_PROFILE();
+    for (uint8_t y = 0; y < i2c_ssd1306->height; y++)
+    {
+        const uint8_t *segment = i2c_ssd1306->page[y / 8].segment;
+        for (uint8_t x = 0; x < i2c_ssd1306->width; x++)
+        {
+            printf("%s", (segment[x] >> (y % 8)) & 0x01 ? "\u2588" : " ");
+        }
+        printf("\n");
+    }
+}
+
+/**
+ * @brief Compare the buffer of the SSD1306 device with a reference framebuffer
+ *
+ * This function compares the buffer of the SSD1306 device byte by byte with a reference framebuffer of total_pages * width
+ * bytes in page order, as produced by the image converter. If they differ, it prints the buffer as a monochrome image where
+ * '+' marks a pixel that is set but should be clear and '-' a pixel that is clear but should be set.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ * @param golden Pointer to the reference framebuffer.
+ *
+ * @return Number of pixels that differ.
+ */
+uint16_t i2c_ssd1306_buffer_compare(i2c_ssd1306_handle_t *i2c_ssd1306, const uint8_t *golden)
+{
+    SSD1306_PROFILE();
+    uint16_t diff = 0;
+    for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
+    {
+        const uint8_t *segment = i2c_ssd1306->page[i].segment;
+        const uint8_t *reference = &golden[i * i2c_ssd1306->width];
+        for (uint8_t j = 0; j < i2c_ssd1306->width; j++)
+        {
+            diff += __builtin_popcount(segment[j] ^ reference[j]);
+        }
+    }
+
+    if (diff == 0)
+        return 0;
+
+    for (uint8_t y = 0; y < i2c_ssd1306->height; y++)
+    {
+        const uint8_t *segment = i2c_ssd1306->page[y / 8].segment;
+        const uint8_t *reference = &golden[(y / 8) * i2c_ssd1306->width];
+        for (uint8_t x = 0; x < i2c_ssd1306->width; x++)
+        {
+            bool actual = (segment[x] >> (y % 8)) & 0x01;
+            bool expected = (reference[x] >> (y % 8)) & 0x01;
+            if (actual == expected)
+                printf("%s", actual ? "\u2588" : " ");
+            else
+                printf("%c", actual ? '+' : '-');
+        }
+        printf("\n");
+    }
+    ESP_LOGE(SSD1306_TAG, "Buffer differs from the reference in %u pixels", diff);
+    return diff;
+}
+
 /**
  * @brief Clear the buffer of the SSD1306 device
  *
@@ -119,6 +431,7 @@ void i2c_ssd1306_buffer_check(i2c_ssd1306_handle_t *i2c_ssd1306)
  */
 void i2c_ssd1306_buffer_clear(i2c_ssd1306_handle_t *i2c_ssd1306)
 {
+    SSD1306_PROFILE();
     for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
     {
         memset(i2c_ssd1306->page[i].segment, 0x00, i2c_ssd1306->width);
@@ -135,6 +448,7 @@ void i2c_ssd1306_buffer_clear(i2c_ssd1306_handle_t *i2c_ssd1306)
  */
 void i2c_ssd1306_buffer_fill(i2c_ssd1306_handle_t *i2c_ssd1306, bool fill)
 {
+    SSD1306_PROFILE();
     for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
     {
         if (fill)
@@ -156,6 +470,7 @@ void i2c_ssd1306_buffer_fill(i2c_ssd1306_handle_t *i2c_ssd1306, bool fill)
  */
 void i2c_ssd1306_buffer_fill_pixel(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, bool fill)
 {
+    SSD1306_PROFILE();
     if (x >= i2c_ssd1306->width || y >= i2c_ssd1306->height)
     {
         ESP_LOGE(SSD1306_TAG, "Invalid pixel coordinates, 'x' must be between 0 and %d, 'y' must be between 0 and %d", i2c_ssd1306->width - 1, i2c_ssd1306->height - 1);
@@ -182,6 +497,7 @@ void i2c_ssd1306_buffer_fill_pixel(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x,
  */
 void i2c_ssd1306_buffer_fill_space(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, bool fill)
 {
+    SSD1306_PROFILE();
     if (x1 >= i2c_ssd1306->width || x2 >= i2c_ssd1306->width || y1 >= i2c_ssd1306->height || y2 >= i2c_ssd1306->height || x1 > x2 || y1 > y2)
     {
         ESP_LOGE(SSD1306_TAG, "Invalid space coordinates, 'x1' and 'x2' must be between 0 and %d, 'y1' and 'y2' must be between 0 and %d, 'x1' must be less than 'x2', 'y1' must be less than 'y2'", i2c_ssd1306->width - 1, i2c_ssd1306->height - 1);
@@ -200,31 +516,142 @@ void i2c_ssd1306_buffer_fill_space(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x1
     }
 }
 
+/**
+ * @brief Find a codepoint in a glyph index
+ *
+ * This function runs a binary search, so a lookup costs log2(total) comparisons however many codepoints the font covers.
+ *
+ * @param index Glyph index sorted by codepoint.
+ * @param total Number of entries of the index.
+ * @param codepoint Unicode codepoint to find.
+ *
+ * @return Pointer to the entry of the codepoint, or NULL if the index does not have it.
+ */
+static const ssd1306_glyph_index_t *i2c_ssd1306_find_glyph(const ssd1306_glyph_index_t *index, size_t total, uint32_t codepoint)
+{
+    size_t low = 0;
+    size_t high = total;
+    while (low < high)
+    {
+        size_t mid = (low + high) / 2;
+        if (index[mid].codepoint < codepoint)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    if (low == total || index[low].codepoint != codepoint)
+        return NULL;
+
+    return &index[low];
+}
+
+/**
+ * @brief Get the glyph of the next character of a UTF-8 text
+ *
+ * This function decodes one character and moves the text past it. ASCII characters index font8x8 directly, other codepoints
+ * are found by a binary search of font8x8_index. Invalid sequences and codepoints without a glyph are drawn as '?'.
+ *
+ * @param text Pointer to the text, moved to the next character.
+ *
+ * @return Pointer to the 8 segments of the glyph.
+ */
+static const uint8_t *i2c_ssd1306_next_glyph(const char **text)
+{
+    const uint8_t *byte = (const uint8_t *)*text;
+    if (byte[0] < 0x80)
+    {
+        *text += 1;
+        return font8x8[byte[0]];
+    }
+
+    uint32_t codepoint;
+    uint8_t size;
+    /* Range of the second byte, narrower after the lead bytes that could start overlong forms, surrogates or codepoints
+     * above U+10FFFF. */
+    uint8_t low = 0x80;
+    uint8_t high = 0xBF;
+    if (byte[0] >= 0xC2 && byte[0] <= 0xDF)
+    {
+        codepoint = byte[0] & 0x1F;
+        size = 2;
+    }
+    else if (byte[0] >= 0xE0 && byte[0] <= 0xEF)
+    {
+        codepoint = byte[0] & 0x0F;
+        size = 3;
+        if (byte[0] == 0xE0)
+            low = 0xA0;
+        else if (byte[0] == 0xED)
+            high = 0x9F;
+    }
+    else if (byte[0] >= 0xF0 && byte[0] <= 0xF4)
+    {
+        codepoint = byte[0] & 0x07;
+        size = 4;
+        if (byte[0] == 0xF0)
+            low = 0x90;
+        else if (byte[0] == 0xF4)
+            high = 0x8F;
+    }
+    else
+    {
+        *text += 1;
+        return font8x8['?'];
+    }
+
+    /* A second byte out of range ends the sequence at the lead byte, its continuation bytes are then drawn as '?' each. */
+    if (byte[1] < low || byte[1] > high)
+    {
+        *text += 1;
+        return font8x8['?'];
+    }
+    codepoint = (codepoint << 6) | (byte[1] & 0x3F);
+
+    /* A missing continuation byte, including the terminating null, ends the sequence there. */
+    for (uint8_t i = 2; i < size; i++)
+    {
+        if ((byte[i] & 0xC0) != 0x80)
+        {
+            *text += i;
+            return font8x8['?'];
+        }
+        codepoint = (codepoint << 6) | (byte[i] & 0x3F);
+    }
+    *text += size;
+
+    const ssd1306_glyph_index_t *entry = i2c_ssd1306_find_glyph(font8x8_index, sizeof(font8x8_index) / sizeof(font8x8_index[0]), codepoint);
+    if (entry == NULL)
+        return font8x8['?'];
+
+    return entry->glyph < 256 ? font8x8[entry->glyph] : font8x8_ext[entry->glyph - 256];
+}
+
 /**
  * @brief Copy 8x8 characters that represent a text to the buffer of the SSD1306 device
  *
- * This function writes a text to the buffer of the SSD1306 device.
+ * This function writes a UTF-8 text to the buffer of the SSD1306 device. Besides ASCII, the font covers Latin-1, Greek and
+ * Cyrillic letters, box drawing and block characters. Other characters are drawn as '?'.
  *
  * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
  * @param x X coordinate of the text.
  * @param y Y coordinate of the text.
- * @param text Text to copy to the buffer.
+ * @param text UTF-8 text to copy to the buffer.
  * @param invert Invert the text if true.
  */
 void i2c_ssd1306_buffer_text(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const char *text, bool invert)
 {
+    SSD1306_PROFILE();
     if (x >= i2c_ssd1306->width || y >= i2c_ssd1306->height)
     {
         ESP_LOGE(SSD1306_TAG, "Invalid text coordinates, 'x' must be between 0 and %d, 'y' must be between 0 and %d", i2c_ssd1306->width - 1, i2c_ssd1306->height - 1);
         return;
     }
 
-    uint8_t len = strlen(text);
     uint8_t page = y / 8;
     uint8_t y_offset = y % 8;
     if (y_offset == 0)
     {
-        for (uint8_t i = 0; i < len; i++)
+        while (*text != '\0')
         {
             if (x + 8 > i2c_ssd1306->width)
             {
@@ -232,12 +659,13 @@ void i2c_ssd1306_buffer_text(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8
                 return;
             }
 
+            const uint8_t *glyph = i2c_ssd1306_next_glyph(&text);
             for (uint8_t j = 0; j < 8; j++)
             {
                 if (invert)
-                    i2c_ssd1306->page[page].segment[x + j] = ~font8x8[(uint8_t)text[i]][j];
+                    i2c_ssd1306->page[page].segment[x + j] = ~glyph[j];
                 else
-                    i2c_ssd1306->page[page].segment[x + j] = font8x8[(uint8_t)text[i]][j];
+                    i2c_ssd1306->page[page].segment[x + j] = glyph[j];
             }
             x += 8;
         }
@@ -250,25 +678,20 @@ void i2c_ssd1306_buffer_text(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8
             return;
         }
 
-        for (uint8_t i = 0; i < len; i++)
+        while (*text != '\0')
         {
             if (x + 8 > i2c_ssd1306->width)
             {
                 ESP_LOGE(SSD1306_TAG, "Text exceeds the width of the display");
                 return;
             }
+            const uint8_t *glyph = i2c_ssd1306_next_glyph(&text);
             for (uint8_t j = 0; j < 8; j++)
             {
-                if (invert)
-                {
-                    i2c_ssd1306->page[page].segment[x + j] |= ~font8x8[(uint8_t)text[i]][j] << y_offset;
-                    i2c_ssd1306->page[page + 1].segment[x + j] |= ~font8x8[(uint8_t)text[i]][j] >> (8 - y_offset);
-                }
-                else
-                {
-                    i2c_ssd1306->page[page].segment[x + j] |= font8x8[(uint8_t)text[i]][j] << y_offset;
-                    i2c_ssd1306->page[page + 1].segment[x + j] |= font8x8[(uint8_t)text[i]][j] >> (8 - y_offset);
-                }
+                /* Inverted in 8 bits, so the shift into the next page does not carry the promoted high bits. */
+                uint8_t column = invert ? (uint8_t)~glyph[j] : glyph[j];
+                i2c_ssd1306->page[page].segment[x + j] |= column << y_offset;
+                i2c_ssd1306->page[page + 1].segment[x + j] |= column >> (8 - y_offset);
             }
             x += 8;
         }
@@ -288,6 +711,7 @@ void i2c_ssd1306_buffer_text(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8
  */
 void i2c_ssd1306_buffer_int(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, int value, bool invert)
 {
+    SSD1306_PROFILE();
     char text[16];
     sprintf(text, "%d", value);
     i2c_ssd1306_buffer_text(i2c_ssd1306, x, y, text, invert);
@@ -307,6 +731,7 @@ void i2c_ssd1306_buffer_int(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_
  */
 void i2c_ssd1306_buffer_float(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, float value, uint8_t decimals, bool invert)
 {
+    SSD1306_PROFILE();
     char text[16];
     sprintf(text, "%.*f", decimals, value);
     i2c_ssd1306_buffer_text(i2c_ssd1306, x, y, text, invert);
@@ -327,6 +752,7 @@ void i2c_ssd1306_buffer_float(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint
  */
 void i2c_ssd1306_buffer_image(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const uint8_t *image, uint8_t width, uint8_t height, bool invert)
 {
+    SSD1306_PROFILE();
     if (x >= i2c_ssd1306->width || y >= i2c_ssd1306->height || width > i2c_ssd1306->width || height > i2c_ssd1306->height || x + width > i2c_ssd1306->width || y + height > i2c_ssd1306->height)
     {
         ESP_LOGE(SSD1306_TAG, "Invalid image coordinates, 'x' must be between 0 and %d, 'y' must be between 0 and %d, 'width' must be between 1 and %d, 'height' must be between 1 and %d, 'x + width' must be less than or equal to %d, 'y + height' must be less than or equal to %d", i2c_ssd1306->width - 1, i2c_ssd1306->height - 1, i2c_ssd1306->width, i2c_ssd1306->height, i2c_ssd1306->width, i2c_ssd1306->height);
@@ -372,39 +798,365 @@ void i2c_ssd1306_buffer_image(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint
 }
 
 /**
- * @brief Transfer a buffer segment to the RAM of the SSD1306 device
+ * @brief Copy an RLE compressed image to the buffer of the SSD1306 device
  *
- * This function transfers a buffer segment to the RAM of the SSD1306 device.
+ * This function decompresses an image produced by ImageToCArray.py with the compress option directly into the buffer of the
+ * SSD1306 device. A control byte with bit 7 set is followed by one byte repeated (control & 0x7F) + 1 times, a control byte
+ * with bit 7 clear is followed by control + 1 literal bytes.
  *
  * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
- * @param page Page number to transfer the buffer segment to the RAM.
- * @param segment Segment number to transfer the buffer segment to the RAM.
+ * @param x X coordinate of the image.
+ * @param y Y coordinate of the image.
+ * @param rle Compressed image to copy to the buffer.
+ * @param rle_size Size in bytes of the compressed image.
+ * @param width Width of the image.
+ * @param height Height of the image.
+ * @param invert Invert the image if true.
  */
-void i2c_ssd1306_segment_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page, uint8_t segment)
+void i2c_ssd1306_buffer_image_rle(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x, uint8_t y, const uint8_t *rle, size_t rle_size, uint8_t width, uint8_t height, bool invert)
 {
-    if (page >= i2c_ssd1306->total_pages)
+    SSD1306_PROFILE();
+    if (x >= i2c_ssd1306->width || y >= i2c_ssd1306->height || width > i2c_ssd1306->width || height > i2c_ssd1306->height || x + width > i2c_ssd1306->width || y + height > i2c_ssd1306->height)
     {
-        ESP_LOGE(SSD1306_TAG, "Invalid page number, must be between 0 and %d", i2c_ssd1306->total_pages - 1);
+        ESP_LOGE(SSD1306_TAG, "Invalid image coordinates, 'x' must be between 0 and %d, 'y' must be between 0 and %d, 'width' must be between 1 and %d, 'height' must be between 1 and %d, 'x + width' must be less than or equal to %d, 'y + height' must be less than or equal to %d", i2c_ssd1306->width - 1, i2c_ssd1306->height - 1, i2c_ssd1306->width, i2c_ssd1306->height, i2c_ssd1306->width, i2c_ssd1306->height);
         return;
     }
 
-    if (segment >= i2c_ssd1306->width)
-    {
-        ESP_LOGE(SSD1306_TAG, "Invalid segment number, must be between 0 and %d", i2c_ssd1306->width - 1);
-        return;
-    }
+    uint8_t initial_page = y / 8;
+    uint8_t final_page = (y + height - 1) / 8;
+    uint8_t page_range = final_page - initial_page;
+    uint8_t y_offset = y % 8;
+    uint8_t image_pages = y_offset == 0 ? page_range + 1 : page_range;
+    uint16_t total = image_pages * width;
+    uint16_t k = 0;
+    size_t pos = 0;
 
-    uint8_t ram_addr_cmd[] = {
-        OLED_CONTROL_BYTE_CMD,
-        OLED_MASK_PAGE_ADDR | page,
-        OLED_MASK_LSB_NIBBLE_SEG_ADDR | (segment & 0x0F),
-        OLED_MASK_HSB_NIBBLE_SEG_ADDR | (segment >> 4 & 0x0F)};
-    ESP_ERROR_CHECK(i2c_master_transmit(i2c_ssd1306->i2c_master_dev, ram_addr_cmd, sizeof(ram_addr_cmd), I2C_MASTER_TIMEOUT_MS / portTICK_PERIOD_MS));
+    while (k < total && pos < rle_size)
+    {
+        uint8_t control = rle[pos++];
+        uint8_t count = (control & 0x7F) + 1;
+        bool run = control & 0x80;
+        for (uint8_t n = 0; n < count && k < total; n++, k++)
+        {
+            if (pos >= rle_size)
+            {
+                ESP_LOGE(SSD1306_TAG, "Truncated RLE image");
+                return;
+            }
+
+            uint8_t byte = run ? rle[pos] : rle[pos++];
+            if (invert)
+                byte = ~byte;
+
+            uint8_t i = k / width;
+            uint8_t j = k % width;
+            if (y_offset == 0)
+            {
+                i2c_ssd1306->page[initial_page + i].segment[x + j] = byte;
+            }
+            else
+            {
+                i2c_ssd1306->page[initial_page + i].segment[x + j] |= (byte << y_offset) & (0xFF << y_offset);
+                i2c_ssd1306->page[initial_page + i + 1].segment[x + j] |= (byte >> (8 - y_offset)) & (0xFF >> (8 - y_offset));
+            }
+        }
+        if (run)
+            pos++;
+    }
+}
+
+/**
+ * @brief Initialize a virtual canvas
+ *
+ * This function initializes an I2C SSD1306 handle that is not attached to any device, with a buffer larger than the panel. All
+ * i2c_ssd1306_buffer_* functions draw on it, and i2c_ssd1306_buffer_viewport() copies a window of it to the buffer of a
+ * display. The *_to_ram functions must not be used on a canvas.
+ *
+ * @param canvas Pointer to the I2C SSD1306 handle of the canvas.
+ * @param width Width of the canvas, maximum 255.
+ * @param height Height of the canvas, multiple of 8, maximum 248.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Invalid argument
+ *     - ESP_ERR_NO_MEM Memory allocation failed
+ */
+esp_err_t i2c_ssd1306_canvas_init(i2c_ssd1306_handle_t *canvas, uint8_t width, uint8_t height)
+{
+    SSD1306_PROFILE();
+    if (width == 0 || height == 0 || height % 8 != 0)
+        return ESP_ERR_INVALID_ARG;
+
+    memset(canvas, 0, sizeof(i2c_ssd1306_handle_t));
+    canvas->panel_width = width;
+    canvas->panel_height = height;
+    canvas->wise = SSD1306_TOP_TO_BOTTOM;
+    canvas->rotation = SSD1306_ROTATION_0;
+
+    return i2c_ssd1306_buffer_alloc(canvas, width, height);
+}
+
+/**
+ * @brief Release a virtual canvas
+ *
+ * This function frees the buffer of a canvas initialized with i2c_ssd1306_canvas_init().
+ *
+ * @param canvas Pointer to the I2C SSD1306 handle of the canvas.
+ */
+void i2c_ssd1306_canvas_deinit(i2c_ssd1306_handle_t *canvas)
+{
+    SSD1306_PROFILE();
+    i2c_ssd1306_buffer_free(canvas);
+}
+
+/**
+ * @brief Copy a window of a canvas to the buffer of the SSD1306 device
+ *
+ * This function copies the window of the canvas starting at the given coordinates, with the size of the buffer of the SSD1306
+ * device, to that buffer. When 'y' is a multiple of 8 each page is a single memcpy, otherwise each byte is assembled from two
+ * canvas pages with one shift each. The content of the canvas is never redrawn, so scrolling only costs this copy and a flush.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ * @param canvas Pointer to the I2C SSD1306 handle of the canvas.
+ * @param x X coordinate of the window in the canvas.
+ * @param y Y coordinate of the window in the canvas.
+ */
+void i2c_ssd1306_buffer_viewport(i2c_ssd1306_handle_t *i2c_ssd1306, const i2c_ssd1306_handle_t *canvas, uint8_t x, uint8_t y)
+{
+    SSD1306_PROFILE();
+    if (i2c_ssd1306->width > canvas->width || i2c_ssd1306->height > canvas->height || x > canvas->width - i2c_ssd1306->width || y > canvas->height - i2c_ssd1306->height)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid viewport coordinates, 'x' must be between 0 and %d, 'y' must be between 0 and %d", canvas->width - i2c_ssd1306->width, canvas->height - i2c_ssd1306->height);
+        return;
+    }
+
+    uint8_t initial_page = y / 8;
+    uint8_t y_offset = y % 8;
+    if (y_offset == 0)
+    {
+        for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
+        {
+            memcpy(i2c_ssd1306->page[i].segment, &canvas->page[initial_page + i].segment[x], i2c_ssd1306->width);
+        }
+    }
+    else
+    {
+        for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
+        {
+            const uint8_t *upper = &canvas->page[initial_page + i].segment[x];
+            const uint8_t *lower = &canvas->page[initial_page + i + 1].segment[x];
+            uint8_t *segment = i2c_ssd1306->page[i].segment;
+            for (uint8_t j = 0; j < i2c_ssd1306->width; j++)
+            {
+                segment[j] = (upper[j] >> y_offset) | (lower[j] << (8 - y_offset));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Expand bytes of a page to a RAM of 4 bits per pixel
+ *
+ * This function converts page bytes, one bit per pixel, to 8 rows of two pixels per byte, with lit pixels at full brightness.
+ *
+ * @param data Page bytes, an even number of them.
+ * @param size Number of page bytes.
+ * @param gray Output of 8 rows of size / 2 bytes.
+ * @param stride Distance between the first bytes of two rows of the output, at least size / 2.
+ */
+static void i2c_ssd1306_expand_gray4(const uint8_t *data, size_t size, uint8_t *gray, size_t stride)
+{
+    for (uint8_t row = 0; row < 8; row++)
+    {
+        uint8_t *out = &gray[row * stride];
+        for (size_t i = 0; i < size; i += 2)
+        {
+            *out++ = ((data[i] >> row) & 0x01 ? 0x0F : 0x00) | ((data[i + 1] >> row) & 0x01 ? 0xF0 : 0x00);
+        }
+    }
+}
+
+/**
+ * @brief Write bytes to the RAM of the SSD1306 device
+ *
+ * This function sets the RAM pointer in page addressing mode and transfers the bytes to the RAM of the SSD1306 device. The
+ * transport sends the address commands and the bytes together, in a single transmission over I2C. The column offset of the
+ * controller is added to the segment, and on 4 bits per pixel controllers the bytes are expanded and sent through a window.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ * @param ram_page RAM page to write to.
+ * @param ram_segment First RAM segment to write to, even on 4 bits per pixel controllers.
+ * @param data Bytes to write, an even number of them on 4 bits per pixel controllers.
+ * @param size Number of bytes to write.
+ * @param async Return before the bytes are sent, the caller must wait on the transport before changing them.
+ */
+static void i2c_ssd1306_ram_write(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t ram_page, uint8_t ram_segment, const uint8_t *data, size_t size, bool async)
+{
+    ssd1306_transport_t *transport = i2c_ssd1306->transport;
+    uint8_t column = ram_segment + i2c_ssd1306->controller->column_offset;
+    if (i2c_ssd1306->controller->addressing == SSD1306_ADDRESSING_GRAY4)
+    {
+        uint8_t window_cmd[] = {
+            SSD1327_CMD_SET_COLUMN_ADDR, column / 2, (column + size - 1) / 2,
+            SSD1327_CMD_SET_ROW_ADDR, ram_page * 8, ram_page * 8 + 7};
+        i2c_ssd1306_expand_gray4(data, size, i2c_ssd1306->gray, size / 2);
+
+        /* The next write expands into the same bytes, so they are sent before returning. */
+        ESP_ERROR_CHECK(transport->write_data(transport, window_cmd, sizeof(window_cmd), i2c_ssd1306->gray, 4 * size));
+        return;
+    }
+
+    uint8_t addr_cmd[5];
+    uint8_t cmd_size = 0;
+    if (i2c_ssd1306->horizontal_mode)
+    {
+        addr_cmd[cmd_size++] = OLED_CMD_SET_MEMORY_ADDR_MODE;
+        addr_cmd[cmd_size++] = 0x02;
+        i2c_ssd1306->horizontal_mode = false;
+    }
+    addr_cmd[cmd_size++] = OLED_MASK_PAGE_ADDR | ram_page;
+    addr_cmd[cmd_size++] = OLED_MASK_LSB_NIBBLE_SEG_ADDR | (column & 0x0F);
+    addr_cmd[cmd_size++] = OLED_MASK_HSB_NIBBLE_SEG_ADDR | (column >> 4 & 0x0F);
+    if (async)
+        ESP_ERROR_CHECK(transport->write_data_async(transport, addr_cmd, cmd_size, data, size));
+    else
+        ESP_ERROR_CHECK(transport->write_data(transport, addr_cmd, cmd_size, data, size));
+}
+
+/**
+ * @brief Write the whole buffer to the RAM of the SSD1306 device in horizontal addressing mode
+ *
+ * This function switches the SSD1306 device to horizontal addressing if needed, sets a column and page window over the pages
+ * and sends them with as few asynchronous writes as the maximum transfer size of the controller allows, a single one for a
+ * 128x64 SSD1306. The next page addressed write switches the SSD1306 device back.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ */
+static void i2c_ssd1306_frame_write(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    ssd1306_transport_t *transport = i2c_ssd1306->transport;
+    uint8_t column = i2c_ssd1306->controller->column_offset;
+    uint8_t width = i2c_ssd1306->width;
+    uint8_t pages_per_write = i2c_ssd1306->controller->max_transfer / width;
+    if (pages_per_write == 0)
+        pages_per_write = 1;
+
+    for (uint8_t page = 0; page < i2c_ssd1306->total_pages; page += pages_per_write)
+    {
+        uint8_t final_page = page + pages_per_write - 1;
+        if (final_page >= i2c_ssd1306->total_pages)
+            final_page = i2c_ssd1306->total_pages - 1;
+
+        uint8_t window_cmd[8];
+        uint8_t cmd_size = 0;
+        if (!i2c_ssd1306->horizontal_mode)
+        {
+            window_cmd[cmd_size++] = OLED_CMD_SET_MEMORY_ADDR_MODE;
+            window_cmd[cmd_size++] = 0x00;
+            i2c_ssd1306->horizontal_mode = true;
+        }
+        window_cmd[cmd_size++] = OLED_CMD_SET_COLUMN_ADDR_RANGE;
+        window_cmd[cmd_size++] = column;
+        window_cmd[cmd_size++] = column + width - 1;
+        window_cmd[cmd_size++] = OLED_CMD_SET_PAGE_ADDR_RANGE;
+        window_cmd[cmd_size++] = page;
+        window_cmd[cmd_size++] = final_page;
+        ESP_ERROR_CHECK(transport->write_data_async(transport, window_cmd, cmd_size, i2c_ssd1306->page[page].segment, (final_page - page + 1) * width));
+    }
+}
+
+/**
+ * @brief Widen a range of buffer segments to whole RAM bytes
+ *
+ * A RAM byte of 4 bits per pixel controllers holds two segments, so on those the range is widened to start on an even segment
+ * and end on an odd one. Their width is even, so the range stays inside the buffer.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ * @param initial_segment Initial segment of the range.
+ * @param final_segment Final segment of the range.
+ */
+static inline void i2c_ssd1306_align_segments(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t *initial_segment, uint8_t *final_segment)
+{
+    if (i2c_ssd1306->controller->addressing == SSD1306_ADDRESSING_GRAY4)
+    {
+        *initial_segment &= ~0x01;
+        *final_segment |= 0x01;
+    }
+}
+
+/**
+ * @brief Transpose an 8x8 bit matrix
+ *
+ * This function transposes 8 bytes as a bit matrix, so that bit 'j' of output byte 'i' is bit 'i' of input byte 'j'. It works
+ * on the whole block at once in a 64-bit word with three mask-and-swap steps instead of 64 single bit moves.
+ *
+ * @param in Input bytes.
+ * @param out Output bytes.
+ */
+static void i2c_ssd1306_transpose_8x8(const uint8_t in[8], uint8_t out[8])
+{
+    uint64_t x = 0;
+    for (uint8_t i = 0; i < 8; i++)
+        x |= (uint64_t)in[i] << (8 * i);
+
+    uint64_t t;
+    t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+    x = x ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+    x = x ^ t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+    x = x ^ t ^ (t << 28);
+
+    for (uint8_t i = 0; i < 8; i++)
+        out[i] = x >> (8 * i);
+}
+
+/**
+ * @brief Transfer a range of buffer segments of a transposed buffer to the RAM of the SSD1306 device
+ *
+ * This function transfers the 8x8 blocks of a buffer rotated by 90 or 270 degrees that contain the given segments. Buffer page
+ * 'page' maps to RAM segments 8 * page to 8 * page + 7, and buffer segment 's' maps to bit s % 8 of RAM page s / 8.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ * @param page Buffer page of the segments.
+ * @param initial_segment Initial buffer segment of the range.
+ * @param final_segment Final buffer segment of the range.
+ */
+static void i2c_ssd1306_transposed_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page, uint8_t initial_segment, uint8_t final_segment)
+{
+    uint8_t block[8];
+    for (uint8_t ram_page = initial_segment / 8; ram_page <= final_segment / 8; ram_page++)
+    {
+        i2c_ssd1306_transpose_8x8(&i2c_ssd1306->page[page].segment[ram_page * 8], block);
+        i2c_ssd1306_ram_write(i2c_ssd1306, ram_page, page * 8, block, sizeof(block), false);
+    }
+}
+
+/**
+ * @brief Transfer a buffer segment to the RAM of the SSD1306 device
+ *
+ * This function transfers a buffer segment to the RAM of the SSD1306 device.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ * @param page Page number to transfer the buffer segment to the RAM.
+ * @param segment Segment number to transfer the buffer segment to the RAM.
+ */
+void i2c_ssd1306_segment_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page, uint8_t segment)
+{
+    SSD1306_PROFILE();
+    if (page >= i2c_ssd1306->total_pages)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid page number, must be between 0 and %d", i2c_ssd1306->total_pages - 1);
+        return;
+    }
+
+    if (segment >= i2c_ssd1306->width)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid segment number, must be between 0 and %d", i2c_ssd1306->width - 1);
+        return;
+    }
 
-    uint8_t ram_data_cmd[] = {
-        OLED_CONTROL_BYTE_DATA,
-        i2c_ssd1306->page[page].segment[segment]};
-    ESP_ERROR_CHECK(i2c_master_transmit(i2c_ssd1306->i2c_master_dev, ram_data_cmd, sizeof(ram_data_cmd), I2C_MASTER_TIMEOUT_MS / portTICK_PERIOD_MS));
+    i2c_ssd1306_segments_to_ram(i2c_ssd1306, page, segment, segment);
 }
 
 /**
@@ -419,6 +1171,7 @@ void i2c_ssd1306_segment_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page,
  */
 void i2c_ssd1306_segments_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page, uint8_t initial_segment, uint8_t final_segment)
 {
+    SSD1306_PROFILE();
     if (page >= i2c_ssd1306->total_pages)
     {
         ESP_LOGE(SSD1306_TAG, "Invalid page number, must be between 0 and %d", i2c_ssd1306->total_pages - 1);
@@ -431,20 +1184,14 @@ void i2c_ssd1306_segments_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page
         return;
     }
 
-    uint8_t ram_addr_cmd[] = {
-        OLED_CONTROL_BYTE_CMD,
-        OLED_MASK_PAGE_ADDR | page,
-        OLED_MASK_LSB_NIBBLE_SEG_ADDR | (initial_segment & 0x0F),
-        OLED_MASK_HSB_NIBBLE_SEG_ADDR | (initial_segment >> 4 & 0x0F)};
-    ESP_ERROR_CHECK(i2c_master_transmit(i2c_ssd1306->i2c_master_dev, ram_addr_cmd, sizeof(ram_addr_cmd), I2C_MASTER_TIMEOUT_MS / portTICK_PERIOD_MS));
-
-    uint8_t ram_data_cmd[final_segment - initial_segment + 2];
-    ram_data_cmd[0] = OLED_CONTROL_BYTE_DATA;
-    for (uint8_t i = 0; i < final_segment - initial_segment + 1; i++)
+    if (i2c_ssd1306_is_transposed(i2c_ssd1306))
     {
-        ram_data_cmd[i + 1] = i2c_ssd1306->page[page].segment[initial_segment + i];
+        i2c_ssd1306_transposed_to_ram(i2c_ssd1306, page, initial_segment, final_segment);
+        return;
     }
-    ESP_ERROR_CHECK(i2c_master_transmit(i2c_ssd1306->i2c_master_dev, ram_data_cmd, sizeof(ram_data_cmd), I2C_MASTER_TIMEOUT_MS / portTICK_PERIOD_MS));
+
+    i2c_ssd1306_align_segments(i2c_ssd1306, &initial_segment, &final_segment);
+    i2c_ssd1306_ram_write(i2c_ssd1306, page, initial_segment, &i2c_ssd1306->page[page].segment[initial_segment], final_segment - initial_segment + 1, false);
 }
 
 /**
@@ -457,39 +1204,300 @@ void i2c_ssd1306_segments_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page
  */
 void i2c_ssd1306_page_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page)
 {
+    SSD1306_PROFILE();
     if (page >= i2c_ssd1306->total_pages)
     {
         ESP_LOGE(SSD1306_TAG, "Invalid page number, must be between 0 and %d", i2c_ssd1306->total_pages - 1);
         return;
     }
 
-    uint8_t ram_addr_cmd[] = {
-        OLED_CONTROL_BYTE_CMD,
-        OLED_MASK_PAGE_ADDR | page,
-        OLED_MASK_LSB_NIBBLE_SEG_ADDR | (0x00 & 0x0F),
-        OLED_MASK_HSB_NIBBLE_SEG_ADDR | (0x00 >> 4 & 0x0F)};
-    ESP_ERROR_CHECK(i2c_master_transmit(i2c_ssd1306->i2c_master_dev, ram_addr_cmd, sizeof(ram_addr_cmd), I2C_MASTER_TIMEOUT_MS / portTICK_PERIOD_MS));
+    if (i2c_ssd1306_is_transposed(i2c_ssd1306))
+        i2c_ssd1306_transposed_to_ram(i2c_ssd1306, page, 0, i2c_ssd1306->width - 1);
+    else
+        i2c_ssd1306_ram_write(i2c_ssd1306, page, 0, i2c_ssd1306->page[page].segment, i2c_ssd1306->width, false);
+}
+
+/**
+ * @brief Write the whole buffer to the RAM of a 4 bits per pixel controller
+ *
+ * This function expands every page into the frame held by the handle, transposing 8x8 blocks first if the buffer is rotated by
+ * 90 or 270 degrees, sets a single column and row window over the panel and sends the frame with asynchronous writes of at
+ * most the maximum transfer size of the controller, a single one for a 128x128 SSD1327. The writes after the first carry no
+ * address commands, the controller continues where the previous one stopped.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ */
+static void i2c_ssd1306_gray4_frame_write(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    ssd1306_transport_t *transport = i2c_ssd1306->transport;
+    uint8_t column = i2c_ssd1306->controller->column_offset;
+    uint8_t panel_width = i2c_ssd1306->panel_width;
+    uint8_t panel_height = i2c_ssd1306->panel_height;
+    size_t stride = panel_width / 2;
+    uint8_t *gray = i2c_ssd1306->gray;
+
+    if (i2c_ssd1306_is_transposed(i2c_ssd1306))
+    {
+        uint8_t block[8];
+        for (uint8_t ram_page = 0; ram_page < panel_height / 8; ram_page++)
+        {
+            for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
+            {
+                i2c_ssd1306_transpose_8x8(&i2c_ssd1306->page[i].segment[ram_page * 8], block);
+                i2c_ssd1306_expand_gray4(block, sizeof(block), &gray[ram_page * 8 * stride + i * 4], stride);
+            }
+        }
+    }
+    else
+    {
+        for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
+        {
+            i2c_ssd1306_expand_gray4(i2c_ssd1306->page[i].segment, panel_width, &gray[i * 8 * stride], stride);
+        }
+    }
 
-    uint8_t ram_data_cmd[i2c_ssd1306->width + 1];
-    ram_data_cmd[0] = OLED_CONTROL_BYTE_DATA;
-    for (uint8_t i = 0; i < i2c_ssd1306->width; i++)
+    const uint8_t window_cmd[] = {
+        SSD1327_CMD_SET_COLUMN_ADDR, column / 2, (column + panel_width - 1) / 2,
+        SSD1327_CMD_SET_ROW_ADDR, 0, panel_height - 1};
+    size_t frame_size = stride * panel_height;
+    size_t max_transfer = i2c_ssd1306->controller->max_transfer;
+    for (size_t offset = 0; offset < frame_size; offset += max_transfer)
     {
-        ram_data_cmd[i + 1] = i2c_ssd1306->page[page].segment[i];
+        size_t size = frame_size - offset < max_transfer ? frame_size - offset : max_transfer;
+        ESP_ERROR_CHECK(transport->write_data_async(transport, window_cmd, offset == 0 ? sizeof(window_cmd) : 0, &gray[offset], size));
     }
-    ESP_ERROR_CHECK(i2c_master_transmit(i2c_ssd1306->i2c_master_dev, ram_data_cmd, sizeof(ram_data_cmd), I2C_MASTER_TIMEOUT_MS / portTICK_PERIOD_MS));
 }
 
 /**
  * @brief Transfer the buffer of all pages to the RAM of the SSD1306 device
  *
- * This function transfers the buffer of all pages to the RAM of the SSD1306 device.
+ * This function transfers the buffer of all pages to the RAM of the SSD1306 device. A transposed buffer is converted a RAM
+ * page at a time, so it takes as many transfers as an unrotated one. An unrotated buffer is sent with asynchronous writes, so
+ * over SPI the pages follow each other as queued DMA transactions. On 4 bits per pixel controllers the expanded frame is sent
+ * through a single window in either orientation.
  *
  * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
  */
 void i2c_ssd1306_pages_to_ram(i2c_ssd1306_handle_t *i2c_ssd1306)
 {
+    SSD1306_PROFILE();
+    /* A failed reallocation in i2c_ssd1306_set_orientation() leaves no buffer to transfer. */
+    if (i2c_ssd1306->page == NULL)
+        return;
+
+    if (i2c_ssd1306->controller->addressing == SSD1306_ADDRESSING_GRAY4)
+    {
+        i2c_ssd1306_gray4_frame_write(i2c_ssd1306);
+        ESP_ERROR_CHECK(i2c_ssd1306->transport->wait(i2c_ssd1306->transport));
+        return;
+    }
+
+    if (!i2c_ssd1306_is_transposed(i2c_ssd1306))
+    {
+        if (i2c_ssd1306->controller->addressing == SSD1306_ADDRESSING_HORIZONTAL)
+        {
+            i2c_ssd1306_frame_write(i2c_ssd1306);
+        }
+        else
+        {
+            for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
+            {
+                i2c_ssd1306_ram_write(i2c_ssd1306, i, 0, i2c_ssd1306->page[i].segment, i2c_ssd1306->width, true);
+            }
+        }
+        ESP_ERROR_CHECK(i2c_ssd1306->transport->wait(i2c_ssd1306->transport));
+        return;
+    }
+
+    uint8_t ram_segment[i2c_ssd1306->panel_width];
+    for (uint8_t ram_page = 0; ram_page < i2c_ssd1306->panel_height / 8; ram_page++)
+    {
+        for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
+        {
+            i2c_ssd1306_transpose_8x8(&i2c_ssd1306->page[i].segment[ram_page * 8], &ram_segment[i * 8]);
+        }
+        i2c_ssd1306_ram_write(i2c_ssd1306, ram_page, 0, ram_segment, sizeof(ram_segment), false);
+    }
+}
+
+/**
+ * @brief Insert a span into the transfer queue of a page
+ *
+ * This function keeps the spans of a page sorted and merges spans that overlap, touch, or are separated by at most
+ * SSD1306_QUEUE_MERGE_GAP segments, since resending a few unchanged bytes is cheaper than another transmission. When the queue
+ * of the page is full, the two closest spans are merged.
+ *
+ * @param queue Pointer to the transfer queue of a page.
+ * @param initial_segment Initial segment of the span.
+ * @param final_segment Final segment of the span.
+ */
+static void i2c_ssd1306_queue_insert(ssd1306_queue_page_t *queue, uint8_t initial_segment, uint8_t final_segment)
+{
+    uint8_t i = queue->count;
+    while (i > 0 && queue->span[i - 1].initial_segment > initial_segment)
+    {
+        queue->span[i] = queue->span[i - 1];
+        i--;
+    }
+    queue->span[i].initial_segment = initial_segment;
+    queue->span[i].final_segment = final_segment;
+    queue->count++;
+
+    uint8_t last = 0;
+    for (uint8_t j = 1; j < queue->count; j++)
+    {
+        if (queue->span[j].initial_segment <= queue->span[last].final_segment + 1 + SSD1306_QUEUE_MERGE_GAP)
+        {
+            if (queue->span[j].final_segment > queue->span[last].final_segment)
+                queue->span[last].final_segment = queue->span[j].final_segment;
+        }
+        else
+        {
+            queue->span[++last] = queue->span[j];
+        }
+    }
+    queue->count = last + 1;
+
+    if (queue->count > SSD1306_QUEUE_MAX_SPANS)
+    {
+        uint8_t closest = 0;
+        for (uint8_t j = 1; j < queue->count - 1; j++)
+        {
+            if (queue->span[j + 1].initial_segment - queue->span[j].final_segment < queue->span[closest + 1].initial_segment - queue->span[closest].final_segment)
+                closest = j;
+        }
+        queue->span[closest].final_segment = queue->span[closest + 1].final_segment;
+        for (uint8_t j = closest + 1; j < queue->count - 1; j++)
+        {
+            queue->span[j] = queue->span[j + 1];
+        }
+        queue->count--;
+    }
+}
+
+/**
+ * @brief Queue a range of buffer segments for transfer to the RAM of the SSD1306 device
+ *
+ * This function records a range of buffer segments to be transferred by i2c_ssd1306_queue_flush(), without any bus traffic.
+ * The data is read from the buffer when the queue is flushed, so a segment queued several times is only sent once.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ * @param page Page number of the buffer segments.
+ * @param initial_segment Initial segment of the range.
+ * @param final_segment Final segment of the range.
+ */
+void i2c_ssd1306_queue_segments(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page, uint8_t initial_segment, uint8_t final_segment)
+{
+    SSD1306_PROFILE();
+    if (page >= i2c_ssd1306->total_pages)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid page number, must be between 0 and %d", i2c_ssd1306->total_pages - 1);
+        return;
+    }
+
+    if (initial_segment >= i2c_ssd1306->width || final_segment >= i2c_ssd1306->width || initial_segment > final_segment)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid segment range, must be between 0 and %d", i2c_ssd1306->width - 1);
+        return;
+    }
+
+    i2c_ssd1306_queue_insert(&i2c_ssd1306->queue[page], initial_segment, final_segment);
+}
+
+/**
+ * @brief Queue a buffer segment for transfer to the RAM of the SSD1306 device
+ *
+ * This function records a buffer segment to be transferred by i2c_ssd1306_queue_flush(). Adjacent and nearby segments are
+ * merged into a single transmission.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ * @param page Page number of the buffer segment.
+ * @param segment Segment number of the buffer segment.
+ */
+void i2c_ssd1306_queue_segment(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t page, uint8_t segment)
+{
+    SSD1306_PROFILE();
+    i2c_ssd1306_queue_segments(i2c_ssd1306, page, segment, segment);
+}
+
+/**
+ * @brief Queue a range of pixels for transfer to the RAM of the SSD1306 device
+ *
+ * This function records every buffer segment covering a rectangular region, typically the region passed to a drawing
+ * function, to be transferred by i2c_ssd1306_queue_flush().
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ * @param x1 X coordinate of the first pixel.
+ * @param x2 X coordinate of the last pixel.
+ * @param y1 Y coordinate of the first pixel.
+ * @param y2 Y coordinate of the last pixel.
+ */
+void i2c_ssd1306_queue_space(i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2)
+{
+    SSD1306_PROFILE();
+    if (x1 >= i2c_ssd1306->width || x2 >= i2c_ssd1306->width || y1 >= i2c_ssd1306->height || y2 >= i2c_ssd1306->height || x1 > x2 || y1 > y2)
+    {
+        ESP_LOGE(SSD1306_TAG, "Invalid space coordinates, 'x1' and 'x2' must be between 0 and %d, 'y1' and 'y2' must be between 0 and %d, 'x1' must be less than 'x2', 'y1' must be less than 'y2'", i2c_ssd1306->width - 1, i2c_ssd1306->height - 1);
+        return;
+    }
+
+    for (uint8_t page = y1 / 8; page <= y2 / 8; page++)
+    {
+        i2c_ssd1306_queue_insert(&i2c_ssd1306->queue[page], x1, x2);
+    }
+}
+
+/**
+ * @brief Discard the transfer queue of the SSD1306 device
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ */
+void i2c_ssd1306_queue_clear(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    SSD1306_PROFILE();
     for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
     {
-        i2c_ssd1306_page_to_ram(i2c_ssd1306, i);
+        i2c_ssd1306->queue[i].count = 0;
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Transfer the queued buffer segments to the RAM of the SSD1306 device
+ *
+ * This function transfers each merged span of the queue in a single transmission that carries both its address commands and
+ * its data, and empties the queue. The spans are sent with asynchronous writes and the function returns once all are sent.
+ *
+ * @param i2c_ssd1306 Pointer to the I2C SSD1306 handle.
+ *
+ * @return Number of transmissions sent.
+ */
+uint16_t i2c_ssd1306_queue_flush(i2c_ssd1306_handle_t *i2c_ssd1306)
+{
+    SSD1306_PROFILE();
+    uint16_t transmissions = 0;
+    bool transposed = i2c_ssd1306_is_transposed(i2c_ssd1306);
+    for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
+    {
+        ssd1306_queue_page_t *queue = &i2c_ssd1306->queue[i];
+        for (uint8_t j = 0; j < queue->count; j++)
+        {
+            uint8_t initial_segment = queue->span[j].initial_segment;
+            uint8_t final_segment = queue->span[j].final_segment;
+            if (transposed)
+            {
+                i2c_ssd1306_transposed_to_ram(i2c_ssd1306, i, initial_segment, final_segment);
+                transmissions += final_segment / 8 - initial_segment / 8 + 1;
+            }
+            else
+            {
+                i2c_ssd1306_align_segments(i2c_ssd1306, &initial_segment, &final_segment);
+                i2c_ssd1306_ram_write(i2c_ssd1306, i, initial_segment, &i2c_ssd1306->page[i].segment[initial_segment], final_segment - initial_segment + 1, true);
+                transmissions++;
+            }
+        }
+        queue->count = 0;
+    }
+    ESP_ERROR_CHECK(i2c_ssd1306->transport->wait(i2c_ssd1306->transport));
+
+    return transmissions;
+}
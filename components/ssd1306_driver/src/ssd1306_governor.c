@@ -0,0 +1,265 @@
+#include "ssd1306_governor.h"
+#include "ssd1306_cmd.h"
+
+/**
+ * @brief Check if the buffer differs from the last transferred frame
+ *
+ * @param governor Pointer to the I2C SSD1306 governor handle.
+ *
+ * @return true if any page of the buffer changed.
+ */
+static bool i2c_ssd1306_governor_changed(i2c_ssd1306_governor_handle_t *governor)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = governor->i2c_ssd1306;
+    for (uint8_t i = 0; i < governor->total_pages; i++)
+    {
+        if (memcmp(i2c_ssd1306->page[i].segment, &governor->shadow[i * governor->width], governor->width) != 0)
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Transfer the changed spans of the buffer to the RAM of the SSD1306 device
+ *
+ * This function queues each run of segments that differ from the last transferred frame, flushes the queue so that nearby runs
+ * share a transmission, and records the bus time.
+ *
+ * @param governor Pointer to the I2C SSD1306 governor handle.
+ */
+static void i2c_ssd1306_governor_flush(i2c_ssd1306_governor_handle_t *governor)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = governor->i2c_ssd1306;
+    uint8_t width = governor->width;
+
+    for (uint8_t i = 0; i < governor->total_pages; i++)
+    {
+        const uint8_t *segment = i2c_ssd1306->page[i].segment;
+        uint8_t *shadow = &governor->shadow[i * width];
+        if (!governor->ram_valid)
+        {
+            i2c_ssd1306_queue_segments(i2c_ssd1306, i, 0, width - 1);
+        }
+        else
+        {
+            uint8_t j = 0;
+            while (j < width)
+            {
+                if (segment[j] == shadow[j])
+                {
+                    j++;
+                    continue;
+                }
+
+                uint8_t initial_segment = j;
+                while (j < width && segment[j] != shadow[j])
+                    j++;
+                i2c_ssd1306_queue_segments(i2c_ssd1306, i, initial_segment, j - 1);
+            }
+        }
+        memcpy(shadow, segment, width);
+    }
+
+    int64_t start = esp_timer_get_time();
+    governor->stats.transmissions += i2c_ssd1306_queue_flush(i2c_ssd1306);
+    governor->stats.busy_us += esp_timer_get_time() - start;
+    governor->stats.flushes++;
+    governor->ram_valid = true;
+}
+
+/**
+ * @brief Initialize the I2C SSD1306 governor
+ *
+ * This function attaches a refresh and power governor to an initialized SSD1306 handle. After this, the application only
+ * draws into the buffer and calls i2c_ssd1306_governor_poll() regularly, instead of calling the *_to_ram functions.
+ *
+ * @param governor Pointer to the I2C SSD1306 governor handle.
+ * @param i2c_ssd1306 Pointer to an initialized I2C SSD1306 handle.
+ * @param config Pointer to the refresh and power policy.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Invalid argument
+ *     - ESP_ERR_NO_MEM Memory allocation failed
+ *     - ESP_FAIL Failed
+ */
+esp_err_t i2c_ssd1306_governor_init(i2c_ssd1306_governor_handle_t *governor, i2c_ssd1306_handle_t *i2c_ssd1306, const ssd1306_governor_config_t *config)
+{
+    if (config->sleep_timeout_ms != 0 && config->dim_timeout_ms > config->sleep_timeout_ms)
+        return ESP_ERR_INVALID_ARG;
+
+    memset(governor, 0, sizeof(i2c_ssd1306_governor_handle_t));
+    governor->i2c_ssd1306 = i2c_ssd1306;
+    governor->config = *config;
+    governor->width = i2c_ssd1306->width;
+    governor->total_pages = i2c_ssd1306->total_pages;
+    governor->shadow = (uint8_t *)calloc(governor->total_pages * governor->width, sizeof(uint8_t));
+    if (governor->shadow == NULL)
+        return ESP_ERR_NO_MEM;
+
+    int64_t now = esp_timer_get_time();
+    governor->last_change_us = now;
+    governor->last_flush_us = 0;
+    governor->stats.since_us = now;
+
+    governor->state = SSD1306_POWER_SLEEP;
+    return i2c_ssd1306_governor_set_state(governor, SSD1306_POWER_ACTIVE);
+}
+
+/**
+ * @brief Release the I2C SSD1306 governor
+ *
+ * @param governor Pointer to the I2C SSD1306 governor handle.
+ */
+void i2c_ssd1306_governor_deinit(i2c_ssd1306_governor_handle_t *governor)
+{
+    free(governor->shadow);
+    governor->shadow = NULL;
+}
+
+/**
+ * @brief Set the power state of the SSD1306 device
+ *
+ * This function applies the active or dim contrast, or turns the display off. The RAM of the SSD1306 device is kept while the
+ * display is off, so waking up needs no refresh.
+ *
+ * @param governor Pointer to the I2C SSD1306 governor handle.
+ * @param state Power state.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_FAIL Failed
+ */
+esp_err_t i2c_ssd1306_governor_set_state(i2c_ssd1306_governor_handle_t *governor, ssd1306_power_state_t state)
+{
+    if (state == governor->state)
+        return ESP_OK;
+
+    esp_err_t ret;
+    ssd1306_transport_t *transport = governor->i2c_ssd1306->transport;
+    int64_t start = esp_timer_get_time();
+    if (state == SSD1306_POWER_SLEEP)
+    {
+        uint8_t sleep_cmd[] = {
+            OLED_CMD_DISPLAY_OFF};
+        ret = transport->write_cmd(transport, sleep_cmd, sizeof(sleep_cmd));
+    }
+    else
+    {
+        uint8_t wake_cmd[] = {
+            OLED_CMD_SET_CONTRAST_CONTROL, state == SSD1306_POWER_DIM ? governor->config.dim_contrast : governor->config.contrast,
+            OLED_CMD_DISPLAY_ON};
+        ret = transport->write_cmd(transport, wake_cmd, sizeof(wake_cmd));
+    }
+    governor->stats.busy_us += esp_timer_get_time() - start;
+    if (ret != ESP_OK)
+        return ret;
+
+    governor->stats.transmissions++;
+    governor->state = state;
+    return ESP_OK;
+}
+
+/**
+ * @brief Run the governor
+ *
+ * This function detects changes in the buffer, wakes the display if needed, and flushes the changed spans as soon as the frame
+ * rate cap allows it. Changes held back by the cap are flushed anyway once they are latency_ms old. Without changes nothing is
+ * transferred, and after the configured idle times the display is dimmed and then turned off.
+ *
+ * @param governor Pointer to the I2C SSD1306 governor handle.
+ *
+ * @return Microseconds until the governor needs to run again.
+ */
+int64_t i2c_ssd1306_governor_poll(i2c_ssd1306_governor_handle_t *governor)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = governor->i2c_ssd1306;
+    int64_t frame_us = governor->config.max_fps != 0 ? 1000000 / governor->config.max_fps : 0;
+    int64_t idle_poll_us = frame_us != 0 ? frame_us : 10000;
+    int64_t now = esp_timer_get_time();
+    governor->stats.polls++;
+
+    if (i2c_ssd1306->width != governor->width || i2c_ssd1306->total_pages != governor->total_pages)
+    {
+        ESP_LOGE(SSD1306_GOVERNOR_TAG, "Buffer size changed, the governor must be initialized again");
+        return idle_poll_us;
+    }
+
+    if (!governor->pending && (!governor->ram_valid || i2c_ssd1306_governor_changed(governor)))
+    {
+        governor->pending = true;
+        governor->first_change_us = now;
+        governor->last_change_us = now;
+        if (governor->state != SSD1306_POWER_ACTIVE)
+            i2c_ssd1306_governor_set_state(governor, SSD1306_POWER_ACTIVE);
+    }
+
+    if (governor->pending)
+    {
+        int64_t frame_left = governor->last_flush_us + frame_us - now;
+        if (frame_left > 0 && governor->config.latency_ms != 0)
+        {
+            int64_t latency_left = governor->first_change_us + governor->config.latency_ms * 1000LL - now;
+            if (latency_left < frame_left)
+                frame_left = latency_left;
+        }
+        if (frame_left > 0)
+            return frame_left;
+
+        i2c_ssd1306_governor_flush(governor);
+        governor->pending = false;
+        governor->last_flush_us = now;
+        governor->last_change_us = now;
+        return idle_poll_us;
+    }
+
+    int64_t idle_us = now - governor->last_change_us;
+    int64_t dim_us = governor->config.dim_timeout_ms * 1000LL;
+    int64_t sleep_us = governor->config.sleep_timeout_ms * 1000LL;
+    if (sleep_us != 0 && idle_us >= sleep_us)
+        i2c_ssd1306_governor_set_state(governor, SSD1306_POWER_SLEEP);
+    else if (dim_us != 0 && idle_us >= dim_us && governor->state == SSD1306_POWER_ACTIVE)
+        i2c_ssd1306_governor_set_state(governor, SSD1306_POWER_DIM);
+
+    return idle_poll_us;
+}
+
+/**
+ * @brief Get the statistics of the governor
+ *
+ * @param governor Pointer to the I2C SSD1306 governor handle.
+ * @param stats Pointer to the structure that receives a copy of the statistics.
+ */
+void i2c_ssd1306_governor_get_stats(i2c_ssd1306_governor_handle_t *governor, ssd1306_governor_stats_t *stats)
+{
+    *stats = governor->stats;
+}
+
+/**
+ * @brief Reset the statistics of the governor
+ *
+ * @param governor Pointer to the I2C SSD1306 governor handle.
+ */
+void i2c_ssd1306_governor_reset_stats(i2c_ssd1306_governor_handle_t *governor)
+{
+    memset(&governor->stats, 0, sizeof(ssd1306_governor_stats_t));
+    governor->stats.since_us = esp_timer_get_time();
+}
+
+/**
+ * @brief Get the bus duty cycle of the governor
+ *
+ * This function returns the share of time spent transferring to the SSD1306 device since the statistics were reset.
+ *
+ * @param governor Pointer to the I2C SSD1306 governor handle.
+ *
+ * @return Bus duty cycle in percent.
+ */
+float i2c_ssd1306_governor_duty_cycle(i2c_ssd1306_governor_handle_t *governor)
+{
+    int64_t elapsed = esp_timer_get_time() - governor->stats.since_us;
+    if (elapsed <= 0)
+        return 0.0f;
+
+    return 100.0f * governor->stats.busy_us / elapsed;
+}
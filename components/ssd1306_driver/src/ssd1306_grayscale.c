@@ -0,0 +1,539 @@
+#include "ssd1306_grayscale.h"
+#include "ssd1306_cmd.h"
+
+/**
+ * @brief Check if a level is lit in a bit-plane
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ * @param plane Bit-plane index.
+ * @param level Gray level.
+ *
+ * @return true if pixels of the given level are lit in the bit-plane.
+ */
+static inline bool i2c_ssd1306_grayscale_plane_lit(i2c_ssd1306_grayscale_handle_t *grayscale, uint8_t plane, uint8_t level)
+{
+    if (grayscale->mode == SSD1306_GRAYSCALE_FRC)
+        return level > plane;
+    else
+        return level & (1 << plane);
+}
+
+/**
+ * @brief Get the contrast a bit-plane is shown with
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ * @param plane Bit-plane index.
+ *
+ * @return Contrast value for OLED_CMD_SET_CONTRAST_CONTROL.
+ */
+static inline uint8_t i2c_ssd1306_grayscale_plane_contrast(i2c_ssd1306_grayscale_handle_t *grayscale, uint8_t plane)
+{
+    if (grayscale->mode == SSD1306_GRAYSCALE_FRC)
+        return grayscale->contrast;
+    else
+        return grayscale->contrast >> (grayscale->total_planes - 1 - plane);
+}
+
+/**
+ * @brief Transfer a bit-plane to the RAM of the SSD1306 device
+ *
+ * This function only transfers the span of pages that differ from the last transferred plane, in a single data transaction
+ * using horizontal addressing. The contrast of the plane is only sent once its data is in RAM: the panel shows RAM as it is
+ * written, so a contrast sent first would weight the previous plane with the new contrast for the whole transfer. In FRC mode
+ * every plane has the same contrast, which is only sent with a forced transfer.
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ * @param plane Bit-plane index.
+ * @param force Transfer every page even if unchanged.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_FAIL Failed
+ */
+static esp_err_t i2c_ssd1306_grayscale_flush(i2c_ssd1306_grayscale_handle_t *grayscale, uint8_t plane, bool force)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = grayscale->i2c_ssd1306;
+    const uint8_t *data = grayscale->planes + plane * grayscale->plane_size;
+    uint8_t *ram = grayscale->ram;
+    uint8_t width = i2c_ssd1306->width;
+    int16_t initial_page = -1;
+    int16_t final_page = -1;
+
+    for (uint8_t i = 0; i < i2c_ssd1306->total_pages; i++)
+    {
+        if (force || memcmp(&data[i * width], &ram[i * width], width) != 0)
+        {
+            if (initial_page < 0)
+                initial_page = i;
+            final_page = i;
+        }
+    }
+
+    if (initial_page >= 0)
+    {
+        uint8_t addr_cmd[] = {
+            OLED_CMD_SET_COLUMN_ADDR_RANGE, 0x00, width - 1,
+            OLED_CMD_SET_PAGE_ADDR_RANGE, initial_page, final_page};
+
+        uint16_t offset = initial_page * width;
+        uint16_t size = (final_page - initial_page + 1) * width;
+        memcpy(&ram[offset], &data[offset], size);
+
+        esp_err_t ret = i2c_ssd1306->transport->write_data(i2c_ssd1306->transport, addr_cmd, sizeof(addr_cmd), &ram[offset], size);
+        grayscale->stats.transfer_bytes += sizeof(addr_cmd) + size;
+        if (ret != ESP_OK)
+            return ret;
+    }
+
+    if (grayscale->mode != SSD1306_GRAYSCALE_CONTRAST && !force)
+        return ESP_OK;
+
+    uint8_t contrast_cmd[] = {
+        OLED_CMD_SET_CONTRAST_CONTROL, i2c_ssd1306_grayscale_plane_contrast(grayscale, plane)};
+    grayscale->stats.transfer_bytes += sizeof(contrast_cmd);
+    return i2c_ssd1306->transport->write_cmd(i2c_ssd1306->transport, contrast_cmd, sizeof(contrast_cmd));
+}
+
+/**
+ * @brief Initialize the I2C SSD1306 grayscale handle
+ *
+ * This function allocates the bit-planes of a grayscale frame on top of an initialized SSD1306 handle. The monochrome buffer
+ * of the SSD1306 handle is kept, so the existing drawing functions can be used and loaded as a gray level.
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ * @param i2c_ssd1306 Pointer to an initialized I2C SSD1306 handle.
+ * @param levels Number of gray levels, between 2 and 4, black included.
+ * @param mode Modulation of the bit-planes.
+ * @param contrast Contrast of the brightest plane.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Invalid argument
+ *     - ESP_ERR_INVALID_STATE Display rotated by 90 or 270 degrees
+ *     - ESP_ERR_NOT_SUPPORTED Controller without horizontal addressing
+ *     - ESP_ERR_NO_MEM Memory allocation failed
+ */
+esp_err_t i2c_ssd1306_grayscale_init(i2c_ssd1306_grayscale_handle_t *grayscale, i2c_ssd1306_handle_t *i2c_ssd1306, uint8_t levels, ssd1306_grayscale_mode_t mode, uint8_t contrast)
+{
+    if (levels < 2 || levels > SSD1306_GRAYSCALE_MAX_LEVELS || (mode != SSD1306_GRAYSCALE_FRC && mode != SSD1306_GRAYSCALE_CONTRAST))
+        return ESP_ERR_INVALID_ARG;
+    if (i2c_ssd1306->rotation == SSD1306_ROTATION_90 || i2c_ssd1306->rotation == SSD1306_ROTATION_270)
+        return ESP_ERR_INVALID_STATE;
+    if (i2c_ssd1306->controller->addressing != SSD1306_ADDRESSING_HORIZONTAL)
+        return ESP_ERR_NOT_SUPPORTED;
+
+    memset(grayscale, 0, sizeof(i2c_ssd1306_grayscale_handle_t));
+    grayscale->i2c_ssd1306 = i2c_ssd1306;
+    grayscale->mode = mode;
+    grayscale->levels = levels;
+    grayscale->contrast = contrast;
+    grayscale->plane_size = i2c_ssd1306->total_pages * i2c_ssd1306->width;
+    if (mode == SSD1306_GRAYSCALE_FRC)
+        grayscale->total_planes = levels - 1;
+    else
+        grayscale->total_planes = levels > 2 ? 2 : 1;
+
+    grayscale->planes = (uint8_t *)calloc(grayscale->total_planes, grayscale->plane_size);
+    grayscale->ram = (uint8_t *)calloc(grayscale->plane_size, sizeof(uint8_t));
+    if (grayscale->planes == NULL || grayscale->ram == NULL)
+    {
+        free(grayscale->planes);
+        free(grayscale->ram);
+        return ESP_ERR_NO_MEM;
+    }
+    i2c_ssd1306_grayscale_reset_stats(grayscale);
+    ESP_LOGI(SSD1306_GRAYSCALE_TAG, "Grayscale with %d levels and %d planes allocated successfully", levels, grayscale->total_planes);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Release the I2C SSD1306 grayscale handle
+ *
+ * This function stops the scheduler if it is running and frees the bit-planes.
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ */
+void i2c_ssd1306_grayscale_deinit(i2c_ssd1306_grayscale_handle_t *grayscale)
+{
+    if (grayscale->running)
+        i2c_ssd1306_grayscale_stop(grayscale);
+
+    free(grayscale->planes);
+    free(grayscale->ram);
+    grayscale->planes = NULL;
+    grayscale->ram = NULL;
+}
+
+/**
+ * @brief Clear the bit-planes of the grayscale frame
+ *
+ * This function sets every pixel of the grayscale frame to black.
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ */
+void i2c_ssd1306_grayscale_clear(i2c_ssd1306_grayscale_handle_t *grayscale)
+{
+    memset(grayscale->planes, 0x00, grayscale->total_planes * grayscale->plane_size);
+}
+
+/**
+ * @brief Set a pixel of the grayscale frame
+ *
+ * This function sets the gray level of a pixel in every bit-plane.
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ * @param x X coordinate of the pixel.
+ * @param y Y coordinate of the pixel.
+ * @param level Gray level, 0 is black and levels - 1 is full brightness.
+ */
+void i2c_ssd1306_grayscale_fill_pixel(i2c_ssd1306_grayscale_handle_t *grayscale, uint8_t x, uint8_t y, uint8_t level)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = grayscale->i2c_ssd1306;
+    if (x >= i2c_ssd1306->width || y >= i2c_ssd1306->height || level >= grayscale->levels)
+    {
+        ESP_LOGE(SSD1306_GRAYSCALE_TAG, "Invalid pixel, 'x' must be between 0 and %d, 'y' must be between 0 and %d, 'level' must be between 0 and %d", i2c_ssd1306->width - 1, i2c_ssd1306->height - 1, grayscale->levels - 1);
+        return;
+    }
+
+    uint16_t index = (y / 8) * i2c_ssd1306->width + x;
+    for (uint8_t i = 0; i < grayscale->total_planes; i++)
+    {
+        uint8_t *plane = grayscale->planes + i * grayscale->plane_size;
+        if (i2c_ssd1306_grayscale_plane_lit(grayscale, i, level))
+            plane[index] |= (1 << (y % 8));
+        else
+            plane[index] &= ~(1 << (y % 8));
+    }
+}
+
+/**
+ * @brief Set a range of pixels of the grayscale frame
+ *
+ * This function sets the gray level of a rectangular region in every bit-plane, a page byte at a time.
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ * @param x1 X coordinate of the first pixel.
+ * @param x2 X coordinate of the last pixel.
+ * @param y1 Y coordinate of the first pixel.
+ * @param y2 Y coordinate of the last pixel.
+ * @param level Gray level, 0 is black and levels - 1 is full brightness.
+ */
+void i2c_ssd1306_grayscale_fill_space(i2c_ssd1306_grayscale_handle_t *grayscale, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint8_t level)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = grayscale->i2c_ssd1306;
+    if (x1 >= i2c_ssd1306->width || x2 >= i2c_ssd1306->width || y1 >= i2c_ssd1306->height || y2 >= i2c_ssd1306->height || x1 > x2 || y1 > y2 || level >= grayscale->levels)
+    {
+        ESP_LOGE(SSD1306_GRAYSCALE_TAG, "Invalid space, 'x1' and 'x2' must be between 0 and %d, 'y1' and 'y2' must be between 0 and %d, 'x1' must be less than 'x2', 'y1' must be less than 'y2', 'level' must be between 0 and %d", i2c_ssd1306->width - 1, i2c_ssd1306->height - 1, grayscale->levels - 1);
+        return;
+    }
+
+    for (uint8_t page = y1 / 8; page <= y2 / 8; page++)
+    {
+        uint8_t mask = 0xFF;
+        if (page == y1 / 8)
+            mask &= 0xFF << (y1 % 8);
+        if (page == y2 / 8)
+            mask &= 0xFF >> (7 - y2 % 8);
+
+        for (uint8_t i = 0; i < grayscale->total_planes; i++)
+        {
+            uint8_t *segment = grayscale->planes + i * grayscale->plane_size + page * i2c_ssd1306->width;
+            bool lit = i2c_ssd1306_grayscale_plane_lit(grayscale, i, level);
+            for (uint8_t j = x1; j <= x2; j++)
+            {
+                if (lit)
+                    segment[j] |= mask;
+                else
+                    segment[j] &= ~mask;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Load the monochrome buffer into the grayscale frame
+ *
+ * This function sets every pixel that is lit in the buffer of the SSD1306 handle to the given gray level, leaving the other
+ * pixels untouched. Any content drawn with the i2c_ssd1306_buffer_* functions can be layered this way.
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ * @param level Gray level, 0 is black and levels - 1 is full brightness.
+ */
+void i2c_ssd1306_grayscale_load_buffer(i2c_ssd1306_grayscale_handle_t *grayscale, uint8_t level)
+{
+    i2c_ssd1306_handle_t *i2c_ssd1306 = grayscale->i2c_ssd1306;
+    if (level >= grayscale->levels)
+    {
+        ESP_LOGE(SSD1306_GRAYSCALE_TAG, "Invalid level, must be between 0 and %d", grayscale->levels - 1);
+        return;
+    }
+
+    for (uint8_t i = 0; i < grayscale->total_planes; i++)
+    {
+        uint8_t *plane = grayscale->planes + i * grayscale->plane_size;
+        bool lit = i2c_ssd1306_grayscale_plane_lit(grayscale, i, level);
+        for (uint8_t page = 0; page < i2c_ssd1306->total_pages; page++)
+        {
+            const uint8_t *mask = i2c_ssd1306->page[page].segment;
+            uint8_t *segment = plane + page * i2c_ssd1306->width;
+            for (uint8_t j = 0; j < i2c_ssd1306->width; j++)
+            {
+                if (lit)
+                    segment[j] |= mask[j];
+                else
+                    segment[j] &= ~mask[j];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Show the next subframe of the grayscale cycle
+ *
+ * This function transfers the next bit-plane and records its timing. It is called by the scheduler task, and can be called
+ * directly to drive the cycle from an application loop instead.
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_FAIL Failed
+ */
+esp_err_t i2c_ssd1306_grayscale_subframe(i2c_ssd1306_grayscale_handle_t *grayscale)
+{
+    int64_t start = esp_timer_get_time();
+    if (grayscale->last_subframe_us != 0)
+    {
+        int64_t interval = start - grayscale->last_subframe_us;
+        if (interval < grayscale->stats.min_interval_us)
+            grayscale->stats.min_interval_us = interval;
+        if (interval > grayscale->stats.max_interval_us)
+            grayscale->stats.max_interval_us = interval;
+        grayscale->stats.total_interval_us += interval;
+    }
+    grayscale->last_subframe_us = start;
+
+    esp_err_t ret = i2c_ssd1306_grayscale_flush(grayscale, grayscale->current_plane, false);
+    grayscale->current_plane = (grayscale->current_plane + 1) % grayscale->total_planes;
+
+    int64_t transfer = esp_timer_get_time() - start;
+    if (transfer > grayscale->stats.max_transfer_us)
+        grayscale->stats.max_transfer_us = transfer;
+    grayscale->stats.total_transfer_us += transfer;
+    grayscale->stats.subframes++;
+
+    return ret;
+}
+
+/**
+ * @brief Wake the scheduler task on each timer period
+ *
+ * @param arg Pointer to the I2C SSD1306 grayscale handle.
+ */
+static void i2c_ssd1306_grayscale_timer_cb(void *arg)
+{
+    i2c_ssd1306_grayscale_handle_t *grayscale = (i2c_ssd1306_grayscale_handle_t *)arg;
+    if (grayscale->running)
+        xTaskNotifyGive(grayscale->task);
+}
+
+/**
+ * @brief Transfer one subframe per timer period until the scheduler is stopped
+ *
+ * Once stopped, the task signals i2c_ssd1306_grayscale_stop() and suspends itself. It is deleted by the stopping task, so its
+ * handle stays valid for as long as the stopping task may notify it.
+ *
+ * @param arg Pointer to the I2C SSD1306 grayscale handle.
+ */
+static void i2c_ssd1306_grayscale_task(void *arg)
+{
+    i2c_ssd1306_grayscale_handle_t *grayscale = (i2c_ssd1306_grayscale_handle_t *)arg;
+    while (true)
+    {
+        uint32_t pending = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (!grayscale->running)
+            break;
+
+        /* More than one pending period means the previous transfer did not finish in time. */
+        if (pending > 1)
+            grayscale->stats.overruns += pending - 1;
+
+        if (i2c_ssd1306_grayscale_subframe(grayscale) != ESP_OK)
+            ESP_LOGE(SSD1306_GRAYSCALE_TAG, "Subframe transfer failed");
+    }
+
+    xSemaphoreGive(grayscale->stopped);
+    vTaskSuspend(NULL);
+}
+
+/**
+ * @brief Start cycling the bit-planes of the grayscale frame
+ *
+ * This function switches the SSD1306 device to horizontal addressing, transfers the first plane and starts a periodic timer
+ * that wakes a dedicated task once per subframe. While running, the grayscale frame owns the RAM of the SSD1306 device and the
+ * *_to_ram functions must not be used.
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ * @param subframe_hz Subframe rate in Hz. A full gray cycle takes one subframe per plane.
+ * @param task_priority Priority of the scheduler task.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Invalid argument
+ *     - ESP_ERR_INVALID_STATE Already running
+ *     - ESP_ERR_NO_MEM Task or timer creation failed
+ *     - ESP_FAIL Failed
+ */
+esp_err_t i2c_ssd1306_grayscale_start(i2c_ssd1306_grayscale_handle_t *grayscale, uint32_t subframe_hz, UBaseType_t task_priority)
+{
+    if (subframe_hz == 0 || subframe_hz > 1000)
+        return ESP_ERR_INVALID_ARG;
+    if (grayscale->running)
+        return ESP_ERR_INVALID_STATE;
+
+    uint8_t mode_cmd[] = {
+        OLED_CMD_SET_MEMORY_ADDR_MODE, 0x00};
+    ssd1306_transport_t *transport = grayscale->i2c_ssd1306->transport;
+    esp_err_t ret = transport->write_cmd(transport, mode_cmd, sizeof(mode_cmd));
+    if (ret != ESP_OK)
+        return ret;
+    grayscale->i2c_ssd1306->horizontal_mode = true;
+
+    ret = i2c_ssd1306_grayscale_flush(grayscale, 0, true);
+    if (ret != ESP_OK)
+        return ret;
+    grayscale->current_plane = grayscale->total_planes > 1 ? 1 : 0;
+    grayscale->last_subframe_us = 0;
+
+    grayscale->stopped = xSemaphoreCreateBinary();
+    if (grayscale->stopped == NULL)
+        return ESP_ERR_NO_MEM;
+
+    grayscale->running = true;
+    if (xTaskCreate(i2c_ssd1306_grayscale_task, "ssd1306_gray", SSD1306_GRAYSCALE_TASK_STACK, grayscale, task_priority, &grayscale->task) != pdPASS)
+    {
+        grayscale->running = false;
+        grayscale->task = NULL;
+        vSemaphoreDelete(grayscale->stopped);
+        grayscale->stopped = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_timer_create_args_t timer_args = {
+        .callback = i2c_ssd1306_grayscale_timer_cb,
+        .arg = grayscale,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "ssd1306_gray",
+    };
+    ret = esp_timer_create(&timer_args, &grayscale->timer);
+    if (ret == ESP_OK)
+        ret = esp_timer_start_periodic(grayscale->timer, 1000000 / subframe_hz);
+    if (ret != ESP_OK)
+    {
+        i2c_ssd1306_grayscale_stop(grayscale);
+        return ret;
+    }
+    ESP_LOGI(SSD1306_GRAYSCALE_TAG, "Grayscale started at %lu subframes per second", (unsigned long)subframe_hz);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Stop cycling the bit-planes of the grayscale frame
+ *
+ * This function stops the timer, waits for the scheduler task to finish its current subframe and deletes it, restores page
+ * addressing and the full contrast set by i2c_ssd1306_init(), and transfers the monochrome buffer of the SSD1306 handle back
+ * to the RAM of the SSD1306 device.
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_STATE Not running
+ *     - ESP_FAIL Failed
+ */
+esp_err_t i2c_ssd1306_grayscale_stop(i2c_ssd1306_grayscale_handle_t *grayscale)
+{
+    if (!grayscale->running)
+        return ESP_ERR_INVALID_STATE;
+
+    grayscale->running = false;
+    if (grayscale->timer != NULL)
+    {
+        esp_timer_stop(grayscale->timer);
+        esp_timer_delete(grayscale->timer);
+        grayscale->timer = NULL;
+    }
+
+    /* The task only suspends itself once stopped, so the handle is valid until it is deleted here. */
+    TaskHandle_t task = grayscale->task;
+    if (task != NULL)
+    {
+        xTaskNotifyGive(task);
+        xSemaphoreTake(grayscale->stopped, portMAX_DELAY);
+        grayscale->task = NULL;
+        vTaskDelete(task);
+    }
+    vSemaphoreDelete(grayscale->stopped);
+    grayscale->stopped = NULL;
+
+    uint8_t restore_cmd[] = {
+        OLED_CMD_SET_MEMORY_ADDR_MODE, 0x02,
+        OLED_CMD_SET_CONTRAST_CONTROL, 0xFF};
+    ssd1306_transport_t *transport = grayscale->i2c_ssd1306->transport;
+    esp_err_t ret = transport->write_cmd(transport, restore_cmd, sizeof(restore_cmd));
+    if (ret != ESP_OK)
+        return ret;
+    grayscale->i2c_ssd1306->horizontal_mode = false;
+
+    i2c_ssd1306_pages_to_ram(grayscale->i2c_ssd1306);
+    return ESP_OK;
+}
+
+/**
+ * @brief Get the timing statistics of the grayscale scheduler
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ * @param stats Pointer to the structure that receives a copy of the statistics.
+ */
+void i2c_ssd1306_grayscale_get_stats(i2c_ssd1306_grayscale_handle_t *grayscale, ssd1306_grayscale_stats_t *stats)
+{
+    *stats = grayscale->stats;
+}
+
+/**
+ * @brief Reset the timing statistics of the grayscale scheduler
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ */
+void i2c_ssd1306_grayscale_reset_stats(i2c_ssd1306_grayscale_handle_t *grayscale)
+{
+    memset(&grayscale->stats, 0, sizeof(ssd1306_grayscale_stats_t));
+    grayscale->stats.min_interval_us = INT64_MAX;
+    grayscale->last_subframe_us = 0;
+}
+
+/**
+ * @brief Print the timing statistics of the grayscale scheduler
+ *
+ * This function prints the achieved subframe and gray cycle rates, the interval jitter and the transfer times, to check that
+ * the bus keeps up with the requested rate.
+ *
+ * @param grayscale Pointer to the I2C SSD1306 grayscale handle.
+ */
+void i2c_ssd1306_grayscale_print_stats(i2c_ssd1306_grayscale_handle_t *grayscale)
+{
+    ssd1306_grayscale_stats_t stats = grayscale->stats;
+    if (stats.subframes < 2)
+    {
+        printf("Grayscale: not enough subframes\n");
+        return;
+    }
+
+    int64_t avg_interval = stats.total_interval_us / (stats.subframes - 1);
+    printf("Grayscale: %lu subframes, %lu overruns, %lu bytes\n", (unsigned long)stats.subframes, (unsigned long)stats.overruns, (unsigned long)stats.transfer_bytes);
+    printf("Grayscale: %.1f subframes/s, %.1f cycles/s\n", 1000000.0 / avg_interval, 1000000.0 / avg_interval / grayscale->total_planes);
+    printf("Grayscale: interval avg %lld us, min %lld us, max %lld us, jitter %lld us\n", (long long)avg_interval, (long long)stats.min_interval_us, (long long)stats.max_interval_us, (long long)(stats.max_interval_us - stats.min_interval_us));
+    printf("Grayscale: transfer avg %lld us, max %lld us\n", (long long)(stats.total_transfer_us / stats.subframes), (long long)stats.max_transfer_us);
+}
@@ -0,0 +1,104 @@
+#include "ssd1306_profile.h"
+
+#ifdef CONFIG_SSD1306_PROFILING
+
+#include "esp_log.h"
+#include <inttypes.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_cpu.h"
+#else
+#include <time.h>
+#endif
+
+static ssd1306_profile_entry_t *ssd1306_profile_head = NULL;
+static ssd1306_profile_entry_t **ssd1306_profile_tail = &ssd1306_profile_head;
+
+/**
+ * @brief Read the profiling clock
+ *
+ * @return CPU cycle count on the target, monotonic nanoseconds on the host. Only differences are meaningful, they wrap after
+ * 2^32 ticks.
+ */
+uint32_t i2c_ssd1306_profile_cycles(void)
+{
+#ifdef ESP_PLATFORM
+    return esp_cpu_get_cycle_count();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec);
+#endif
+}
+
+/**
+ * @brief Record the end of a profiled call
+ *
+ * This function is run by SSD1306_PROFILE() when the profiled function returns. The entry is linked into the report on its
+ * first call.
+ *
+ * @param scope Pointer to the call in progress.
+ */
+void i2c_ssd1306_profile_end(ssd1306_profile_scope_t *scope)
+{
+    uint32_t cycles = i2c_ssd1306_profile_cycles() - scope->start;
+    ssd1306_profile_entry_t *entry = scope->entry;
+    if (entry->next == NULL && ssd1306_profile_tail != &entry->next)
+    {
+        *ssd1306_profile_tail = entry;
+        ssd1306_profile_tail = &entry->next;
+    }
+
+    entry->calls++;
+    entry->total_cycles += cycles;
+    if (cycles > entry->max_cycles)
+        entry->max_cycles = cycles;
+}
+
+/**
+ * @brief Get the profiled functions
+ *
+ * @return First profiled function, the others follow through the next field. NULL if no profiled function was called.
+ */
+const ssd1306_profile_entry_t *i2c_ssd1306_profile_entries(void)
+{
+    return ssd1306_profile_head;
+}
+
+/**
+ * @brief Log the timing of the profiled functions
+ *
+ * This function logs one line per called function with its number of calls and its total, average and maximum time.
+ */
+void i2c_ssd1306_profile_report(void)
+{
+#ifdef ESP_PLATFORM
+    ESP_LOGI(SSD1306_PROFILE_TAG, "%-32s %10s %14s %10s %10s", "function", "calls", "total cycles", "average", "max");
+#else
+    ESP_LOGI(SSD1306_PROFILE_TAG, "%-32s %10s %14s %10s %10s", "function", "calls", "total ns", "average", "max");
+#endif
+    for (const ssd1306_profile_entry_t *entry = ssd1306_profile_head; entry != NULL; entry = entry->next)
+    {
+        if (entry->calls == 0)
+            continue;
+        ESP_LOGI(SSD1306_PROFILE_TAG, "%-32s %10" PRIu32 " %14" PRIu64 " %10" PRIu64 " %10" PRIu32, entry->name, entry->calls, entry->total_cycles,
+                 entry->total_cycles / entry->calls, entry->max_cycles);
+    }
+}
+
+/**
+ * @brief Clear the timing of the profiled functions
+ *
+ * The functions stay in the report, with no calls, so a reset between two phases of the application measures each phase.
+ */
+void i2c_ssd1306_profile_reset(void)
+{
+    for (ssd1306_profile_entry_t *entry = ssd1306_profile_head; entry != NULL; entry = entry->next)
+    {
+        entry->calls = 0;
+        entry->total_cycles = 0;
+        entry->max_cycles = 0;
+    }
+}
+
+#endif
@@ -0,0 +1,391 @@
+#include "ssd1306_transport.h"
+#include "ssd1306_cmd.h"
+
+#ifdef ESP_PLATFORM
+
+#include "freertos/task.h"
+#include "driver/gpio.h"
+#include "esp_attr.h"
+
+/**
+ * @brief I2C SSD1306 transport type
+ *
+ * This structure stores the I2C master device and a transmission buffer reused by every write, large enough for the largest
+ * write so far.
+ */
+typedef struct
+{
+    ssd1306_transport_t base;
+    i2c_master_dev_handle_t i2c_master_dev;
+    uint8_t *buffer;
+    size_t buffer_size;
+} ssd1306_i2c_transport_t;
+
+/**
+ * @brief SSD1306 SPI data / command level type
+ *
+ * This structure stores the level the data / command GPIO is set to before a transaction starts.
+ */
+typedef struct
+{
+    int io_num;
+    uint32_t level;
+} ssd1306_spi_dc_t;
+
+/**
+ * @brief SPI SSD1306 transport type
+ *
+ * This structure stores the SPI device and a ring of transaction pairs, one for the address commands and one for the data of
+ * each asynchronous write.
+ */
+typedef struct
+{
+    ssd1306_transport_t base;
+    spi_device_handle_t spi_device;
+    ssd1306_spi_dc_t dc_cmd;
+    ssd1306_spi_dc_t dc_data;
+    spi_transaction_t trans[SSD1306_SPI_QUEUE_SIZE][2];
+    uint8_t trans_count[SSD1306_SPI_QUEUE_SIZE];
+    uint8_t cmd[SSD1306_SPI_QUEUE_SIZE][SSD1306_TRANSPORT_MAX_CMD];
+    uint8_t head;
+    uint8_t tail;
+    uint8_t pending;
+} ssd1306_spi_transport_t;
+
+/**
+ * @brief Make sure the transmission buffer of the I2C transport holds at least the given number of bytes
+ *
+ * @param i2c Pointer to the I2C SSD1306 transport.
+ * @param size Number of bytes needed.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_NO_MEM Memory allocation failed
+ */
+static esp_err_t ssd1306_i2c_reserve(ssd1306_i2c_transport_t *i2c, size_t size)
+{
+    if (size <= i2c->buffer_size)
+        return ESP_OK;
+
+    uint8_t *buffer = (uint8_t *)realloc(i2c->buffer, size);
+    if (buffer == NULL)
+        return ESP_ERR_NO_MEM;
+
+    i2c->buffer = buffer;
+    i2c->buffer_size = size;
+    return ESP_OK;
+}
+
+static esp_err_t ssd1306_i2c_write_cmd(ssd1306_transport_t *transport, const uint8_t *cmd, size_t size)
+{
+    ssd1306_i2c_transport_t *i2c = (ssd1306_i2c_transport_t *)transport;
+    esp_err_t ret = ssd1306_i2c_reserve(i2c, size + 1);
+    if (ret != ESP_OK)
+        return ret;
+
+    i2c->buffer[0] = OLED_CONTROL_BYTE_CMD;
+    memcpy(&i2c->buffer[1], cmd, size);
+    return i2c_master_transmit(i2c->i2c_master_dev, i2c->buffer, size + 1, I2C_MASTER_TIMEOUT_MS / portTICK_PERIOD_MS);
+}
+
+/**
+ * @brief Write address commands and RAM bytes over I2C
+ *
+ * This function sends everything in a single transmission, each address command behind its own single command control byte
+ * and the RAM bytes behind a data control byte.
+ */
+static esp_err_t ssd1306_i2c_write_data(ssd1306_transport_t *transport, const uint8_t *cmd, size_t cmd_size, const uint8_t *data, size_t size)
+{
+    ssd1306_i2c_transport_t *i2c = (ssd1306_i2c_transport_t *)transport;
+    esp_err_t ret = ssd1306_i2c_reserve(i2c, 2 * cmd_size + 1 + size);
+    if (ret != ESP_OK)
+        return ret;
+
+    uint8_t *buffer = i2c->buffer;
+    for (size_t i = 0; i < cmd_size; i++)
+    {
+        *buffer++ = OLED_CONTROL_BYTE_CMD_SINGLE;
+        *buffer++ = cmd[i];
+    }
+    *buffer++ = OLED_CONTROL_BYTE_DATA;
+    memcpy(buffer, data, size);
+    return i2c_master_transmit(i2c->i2c_master_dev, i2c->buffer, 2 * cmd_size + 1 + size, I2C_MASTER_TIMEOUT_MS / portTICK_PERIOD_MS);
+}
+
+static esp_err_t ssd1306_i2c_wait(ssd1306_transport_t *transport)
+{
+    return ESP_OK;
+}
+
+static void ssd1306_i2c_del(ssd1306_transport_t *transport)
+{
+    ssd1306_i2c_transport_t *i2c = (ssd1306_i2c_transport_t *)transport;
+    i2c_master_bus_rm_device(i2c->i2c_master_dev);
+    free(i2c->buffer);
+    free(i2c);
+}
+
+/**
+ * @brief Create an I2C SSD1306 transport
+ *
+ * This function adds the SSD1306 device to an initialized I2C master bus. Asynchronous writes are sent right away, since the
+ * data is copied into the transmission buffer anyway.
+ *
+ * @param i2c_master_bus Initialized I2C master bus handle.
+ * @param i2c_addr I2C address of the SSD1306 device.
+ * @param i2c_scl_speed_hz I2C SCL speed in Hz, maximum is 400kHz.
+ * @param transport Pointer that receives the transport.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Invalid argument
+ *     - ESP_ERR_NO_MEM Memory allocation failed
+ *     - ESP_FAIL Failed
+ */
+esp_err_t ssd1306_transport_new_i2c(i2c_master_bus_handle_t i2c_master_bus, uint8_t i2c_addr, uint32_t i2c_scl_speed_hz, ssd1306_transport_t **transport)
+{
+    if (i2c_scl_speed_hz > 400000)
+        return ESP_ERR_INVALID_ARG;
+
+    ssd1306_i2c_transport_t *i2c = (ssd1306_i2c_transport_t *)calloc(1, sizeof(ssd1306_i2c_transport_t));
+    if (i2c == NULL)
+        return ESP_ERR_NO_MEM;
+
+    i2c_device_config_t i2c_device_config = {
+        .dev_addr_length = I2C_ADDR_BIT_7,
+        .device_address = i2c_addr,
+        .scl_speed_hz = i2c_scl_speed_hz,
+    };
+    esp_err_t ret = i2c_master_bus_add_device(i2c_master_bus, &i2c_device_config, &i2c->i2c_master_dev);
+    if (ret != ESP_OK)
+    {
+        free(i2c);
+        return ret;
+    }
+    ESP_LOGI(SSD1306_TRANSPORT_TAG, "I2C SSD1306 device added successfully");
+
+    i2c->base.write_cmd = ssd1306_i2c_write_cmd;
+    i2c->base.write_data = ssd1306_i2c_write_data;
+    i2c->base.write_data_async = ssd1306_i2c_write_data;
+    i2c->base.wait = ssd1306_i2c_wait;
+    i2c->base.del = ssd1306_i2c_del;
+    *transport = &i2c->base;
+    return ESP_OK;
+}
+
+/**
+ * @brief Set the data / command GPIO before an SPI transaction starts
+ *
+ * @param trans SPI transaction, its user field points to the level to set.
+ */
+static void IRAM_ATTR ssd1306_spi_pre_transfer(spi_transaction_t *trans)
+{
+    ssd1306_spi_dc_t *dc = (ssd1306_spi_dc_t *)trans->user;
+    gpio_set_level(dc->io_num, dc->level);
+}
+
+/**
+ * @brief Wait for the oldest asynchronous write of the SPI transport
+ *
+ * @param spi Pointer to the SPI SSD1306 transport.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_FAIL Failed
+ */
+static esp_err_t ssd1306_spi_reclaim(ssd1306_spi_transport_t *spi)
+{
+    esp_err_t ret = ESP_OK;
+    spi_transaction_t *trans;
+    for (uint8_t i = 0; i < spi->trans_count[spi->tail]; i++)
+    {
+        esp_err_t err = spi_device_get_trans_result(spi->spi_device, &trans, portMAX_DELAY);
+        if (err != ESP_OK)
+            ret = err;
+    }
+    spi->tail = (spi->tail + 1) % SSD1306_SPI_QUEUE_SIZE;
+    spi->pending--;
+    return ret;
+}
+
+static esp_err_t ssd1306_spi_wait(ssd1306_transport_t *transport)
+{
+    ssd1306_spi_transport_t *spi = (ssd1306_spi_transport_t *)transport;
+    esp_err_t ret = ESP_OK;
+    while (spi->pending > 0)
+    {
+        esp_err_t err = ssd1306_spi_reclaim(spi);
+        if (err != ESP_OK)
+            ret = err;
+    }
+    return ret;
+}
+
+/**
+ * @brief Send bytes over SPI in a blocking transaction
+ *
+ * @param spi Pointer to the SPI SSD1306 transport.
+ * @param dc Level of the data / command GPIO.
+ * @param bytes Bytes to send.
+ * @param size Number of bytes to send.
+ */
+static esp_err_t ssd1306_spi_transmit(ssd1306_spi_transport_t *spi, ssd1306_spi_dc_t *dc, const uint8_t *bytes, size_t size)
+{
+    spi_transaction_t trans = {
+        .length = size * 8,
+        .tx_buffer = bytes,
+        .user = dc};
+    return spi_device_polling_transmit(spi->spi_device, &trans);
+}
+
+static esp_err_t ssd1306_spi_write_cmd(ssd1306_transport_t *transport, const uint8_t *cmd, size_t size)
+{
+    ssd1306_spi_transport_t *spi = (ssd1306_spi_transport_t *)transport;
+    esp_err_t ret = ssd1306_spi_wait(transport);
+    if (ret != ESP_OK)
+        return ret;
+
+    return ssd1306_spi_transmit(spi, &spi->dc_cmd, cmd, size);
+}
+
+static esp_err_t ssd1306_spi_write_data(ssd1306_transport_t *transport, const uint8_t *cmd, size_t cmd_size, const uint8_t *data, size_t size)
+{
+    ssd1306_spi_transport_t *spi = (ssd1306_spi_transport_t *)transport;
+    esp_err_t ret = ssd1306_spi_wait(transport);
+    if (ret != ESP_OK)
+        return ret;
+
+    if (cmd_size > 0)
+    {
+        ret = ssd1306_spi_transmit(spi, &spi->dc_cmd, cmd, cmd_size);
+        if (ret != ESP_OK)
+            return ret;
+    }
+    return ssd1306_spi_transmit(spi, &spi->dc_data, data, size);
+}
+
+/**
+ * @brief Queue address commands and RAM bytes over SPI
+ *
+ * This function copies the address commands into the next free transaction pair and queues both transactions for DMA, so the
+ * caller can prepare the next write while this one is sent. If every pair is in flight, it first waits for the oldest one.
+ */
+static esp_err_t ssd1306_spi_write_data_async(ssd1306_transport_t *transport, const uint8_t *cmd, size_t cmd_size, const uint8_t *data, size_t size)
+{
+    ssd1306_spi_transport_t *spi = (ssd1306_spi_transport_t *)transport;
+    if (cmd_size > SSD1306_TRANSPORT_MAX_CMD)
+        return ESP_ERR_INVALID_SIZE;
+
+    esp_err_t ret;
+    if (spi->pending == SSD1306_SPI_QUEUE_SIZE)
+    {
+        ret = ssd1306_spi_reclaim(spi);
+        if (ret != ESP_OK)
+            return ret;
+    }
+
+    uint8_t head = spi->head;
+    spi_transaction_t *trans = spi->trans[head];
+    uint8_t count = 0;
+    if (cmd_size > 0)
+    {
+        memcpy(spi->cmd[head], cmd, cmd_size);
+        trans[count++] = (spi_transaction_t){
+            .length = cmd_size * 8,
+            .tx_buffer = spi->cmd[head],
+            .user = &spi->dc_cmd};
+    }
+    trans[count++] = (spi_transaction_t){
+        .length = size * 8,
+        .tx_buffer = data,
+        .user = &spi->dc_data};
+
+    spi->trans_count[head] = 0;
+    spi->head = (head + 1) % SSD1306_SPI_QUEUE_SIZE;
+    spi->pending++;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        ret = spi_device_queue_trans(spi->spi_device, &trans[i], portMAX_DELAY);
+        if (ret != ESP_OK)
+            return ret;
+        spi->trans_count[head]++;
+    }
+    return ESP_OK;
+}
+
+static void ssd1306_spi_del(ssd1306_transport_t *transport)
+{
+    ssd1306_spi_transport_t *spi = (ssd1306_spi_transport_t *)transport;
+    ssd1306_spi_wait(transport);
+    spi_bus_remove_device(spi->spi_device);
+    free(spi);
+}
+
+/**
+ * @brief Create an SPI SSD1306 transport
+ *
+ * This function configures the data / command and reset GPIOs, resets the SSD1306 device if a reset GPIO is given, and adds the
+ * device to an initialized SPI bus. Data writes are queued as DMA transactions, so a full frame at 10MHz takes about 1ms.
+ *
+ * @param config Pointer to the SPI configuration.
+ * @param transport Pointer that receives the transport.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Invalid argument
+ *     - ESP_ERR_NO_MEM Memory allocation failed
+ *     - ESP_FAIL Failed
+ */
+esp_err_t ssd1306_transport_new_spi(const ssd1306_spi_config_t *config, ssd1306_transport_t **transport)
+{
+    if (config->clock_speed_hz > SSD1306_SPI_MAX_SPEED_HZ || config->dc_io_num < 0)
+        return ESP_ERR_INVALID_ARG;
+
+    gpio_config_t io_config = {
+        .pin_bit_mask = 1ULL << config->dc_io_num,
+        .mode = GPIO_MODE_OUTPUT};
+    if (config->rst_io_num >= 0)
+        io_config.pin_bit_mask |= 1ULL << config->rst_io_num;
+    esp_err_t ret = gpio_config(&io_config);
+    if (ret != ESP_OK)
+        return ret;
+
+    if (config->rst_io_num >= 0)
+    {
+        gpio_set_level(config->rst_io_num, 0);
+        vTaskDelay(1);
+        gpio_set_level(config->rst_io_num, 1);
+        vTaskDelay(1);
+    }
+
+    ssd1306_spi_transport_t *spi = (ssd1306_spi_transport_t *)calloc(1, sizeof(ssd1306_spi_transport_t));
+    if (spi == NULL)
+        return ESP_ERR_NO_MEM;
+
+    spi_device_interface_config_t spi_device_config = {
+        .clock_speed_hz = config->clock_speed_hz,
+        .mode = 0,
+        .spics_io_num = config->cs_io_num,
+        .queue_size = 2 * SSD1306_SPI_QUEUE_SIZE,
+        .pre_cb = ssd1306_spi_pre_transfer,
+    };
+    ret = spi_bus_add_device(config->spi_host, &spi_device_config, &spi->spi_device);
+    if (ret != ESP_OK)
+    {
+        free(spi);
+        return ret;
+    }
+    ESP_LOGI(SSD1306_TRANSPORT_TAG, "SPI SSD1306 device added successfully");
+
+    spi->dc_cmd = (ssd1306_spi_dc_t){.io_num = config->dc_io_num, .level = 0};
+    spi->dc_data = (ssd1306_spi_dc_t){.io_num = config->dc_io_num, .level = 1};
+    spi->base.write_cmd = ssd1306_spi_write_cmd;
+    spi->base.write_data = ssd1306_spi_write_data;
+    spi->base.write_data_async = ssd1306_spi_write_data_async;
+    spi->base.wait = ssd1306_spi_wait;
+    spi->base.del = ssd1306_spi_del;
+    *transport = &spi->base;
+    return ESP_OK;
+}
+
+#endif
@@ -0,0 +1,126 @@
+#include "ssd1306_transport_mock.h"
+#include <stdlib.h>
+
+/**
+ * @brief Record a write in the mock transport
+ *
+ * The arrays of the mock transport grow by doubling, so recording a long test costs few reallocations.
+ *
+ * @param mock Pointer to the SSD1306 mock transport.
+ * @param data true for a data write.
+ * @param cmd Pointer to the command bytes.
+ * @param cmd_size Number of command bytes.
+ * @param bytes Pointer to the data bytes, NULL for a command write.
+ * @param size Number of data bytes.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_NO_MEM Memory allocation failed
+ *     - Any other error set in the 'error' field of the mock transport
+ */
+static esp_err_t ssd1306_mock_record(ssd1306_mock_transport_t *mock, bool data, const uint8_t *cmd, size_t cmd_size, const uint8_t *bytes, size_t size)
+{
+    if (mock->error != ESP_OK)
+        return mock->error;
+
+    if (mock->total_writes == mock->writes_capacity)
+    {
+        size_t capacity = mock->writes_capacity != 0 ? 2 * mock->writes_capacity : 64;
+        ssd1306_mock_write_t *writes = (ssd1306_mock_write_t *)realloc(mock->writes, capacity * sizeof(ssd1306_mock_write_t));
+        if (writes == NULL)
+            return ESP_ERR_NO_MEM;
+        mock->writes = writes;
+        mock->writes_capacity = capacity;
+    }
+
+    if (mock->total_bytes + cmd_size + size > mock->bytes_capacity)
+    {
+        size_t capacity = mock->bytes_capacity != 0 ? mock->bytes_capacity : 1024;
+        while (mock->total_bytes + cmd_size + size > capacity)
+            capacity *= 2;
+        uint8_t *buffer = (uint8_t *)realloc(mock->bytes, capacity);
+        if (buffer == NULL)
+            return ESP_ERR_NO_MEM;
+        mock->bytes = buffer;
+        mock->bytes_capacity = capacity;
+    }
+
+    mock->writes[mock->total_writes++] = (ssd1306_mock_write_t){
+        .data = data,
+        .offset = mock->total_bytes,
+        .cmd_size = cmd_size,
+        .size = size,
+    };
+    if (cmd_size != 0)
+        memcpy(&mock->bytes[mock->total_bytes], cmd, cmd_size);
+    mock->total_bytes += cmd_size;
+    if (size != 0)
+        memcpy(&mock->bytes[mock->total_bytes], bytes, size);
+    mock->total_bytes += size;
+    return ESP_OK;
+}
+
+static esp_err_t ssd1306_mock_write_cmd(ssd1306_transport_t *transport, const uint8_t *cmd, size_t size)
+{
+    return ssd1306_mock_record((ssd1306_mock_transport_t *)transport, false, cmd, size, NULL, 0);
+}
+
+static esp_err_t ssd1306_mock_write_data(ssd1306_transport_t *transport, const uint8_t *cmd, size_t cmd_size, const uint8_t *data, size_t size)
+{
+    return ssd1306_mock_record((ssd1306_mock_transport_t *)transport, true, cmd, cmd_size, data, size);
+}
+
+static esp_err_t ssd1306_mock_wait(ssd1306_transport_t *transport)
+{
+    return ESP_OK;
+}
+
+static void ssd1306_mock_del(ssd1306_transport_t *transport)
+{
+    ssd1306_mock_transport_t *mock = (ssd1306_mock_transport_t *)transport;
+    free(mock->writes);
+    free(mock->bytes);
+    free(mock);
+}
+
+/**
+ * @brief Create an SSD1306 mock transport
+ *
+ * This function creates a transport that records every write instead of sending it, for tests on a host or on the target
+ * without a display. The recorded writes are read through the ssd1306_mock_transport_t the transport points to.
+ *
+ * @param transport Pointer that receives the transport.
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_NO_MEM Memory allocation failed
+ */
+esp_err_t ssd1306_transport_new_mock(ssd1306_transport_t **transport)
+{
+    ssd1306_mock_transport_t *mock = (ssd1306_mock_transport_t *)calloc(1, sizeof(ssd1306_mock_transport_t));
+    if (mock == NULL)
+        return ESP_ERR_NO_MEM;
+
+    mock->error = ESP_OK;
+    mock->base.write_cmd = ssd1306_mock_write_cmd;
+    mock->base.write_data = ssd1306_mock_write_data;
+    mock->base.write_data_async = ssd1306_mock_write_data;
+    mock->base.wait = ssd1306_mock_wait;
+    mock->base.del = ssd1306_mock_del;
+    *transport = &mock->base;
+    return ESP_OK;
+}
+
+/**
+ * @brief Forget the writes recorded by an SSD1306 mock transport
+ *
+ * The memory is kept for the next writes.
+ *
+ * @param transport Pointer to a transport created by ssd1306_transport_new_mock().
+ */
+void ssd1306_transport_mock_clear(ssd1306_transport_t *transport)
+{
+    ssd1306_mock_transport_t *mock = (ssd1306_mock_transport_t *)transport;
+    mock->total_writes = 0;
+    mock->total_bytes = 0;
+}
@@ -0,0 +1,220 @@
+/* The driver source is compiled into the benchmark to reach its static glyph lookup. */
+#include "ssd1306_driver.c"
+#include "ssd1306_transport_mock.h"
+#include <math.h>
+#include <time.h>
+
+/**
+ * Text benchmark
+ *
+ * Times i2c_ssd1306_next_glyph() and i2c_ssd1306_buffer_text() on ASCII and Cyrillic text, and the binary search of
+ * i2c_ssd1306_find_glyph() on font8x8_index and on generated sorted indexes of several thousand codepoints. The time of a
+ * lookup should grow with log2 of the size of the index, not with its size.
+ *
+ *     bench_text            Run every benchmark.
+ *     bench_text <rounds>   Repeat each benchmark <rounds> times instead of 200, for steadier numbers.
+ */
+
+#define BENCH_TAG "Text benchmark"
+
+static const char *bench_ascii = "The quick brown fox jumps over the lazy dog 0123456789 ";
+static const char *bench_cyrillic = "Съешь же ещё этих мягких французских булок, да выпей чаю ";
+
+/* Keeps the compiler from dropping the work being timed. */
+static volatile uint32_t bench_sink;
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Repeat a text until it fills a buffer
+ *
+ * @param text Text to repeat, made of whole UTF-8 characters.
+ * @param size Size of the buffer, including the terminating null.
+ *
+ * @return Allocated text, freed by the caller.
+ */
+static char *bench_repeat(const char *text, size_t size)
+{
+    char *buffer = (char *)malloc(size);
+    if (buffer == NULL)
+        abort();
+
+    size_t length = strlen(text);
+    size_t used = 0;
+    while (used + length < size)
+    {
+        memcpy(&buffer[used], text, length);
+        used += length;
+    }
+    buffer[used] = '\0';
+    return buffer;
+}
+
+static void bench_next_glyph(const char *name, const char *sample, unsigned rounds)
+{
+    char *text = bench_repeat(sample, 4096);
+    size_t characters = 0;
+    uint32_t sum = 0;
+
+    uint64_t start = bench_now_ns();
+    for (unsigned round = 0; round < rounds; round++)
+    {
+        const char *cursor = text;
+        while (*cursor != '\0')
+        {
+            sum += i2c_ssd1306_next_glyph(&cursor)[3];
+            characters++;
+        }
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+    bench_sink = sum;
+
+    printf("next_glyph   %-10s %8zu chars  %7.2f ns/char\n", name, characters, (double)elapsed / characters);
+    free(text);
+}
+
+static void bench_buffer_text(i2c_ssd1306_handle_t *ssd1306, const char *name, const char *sample, uint8_t y, unsigned rounds)
+{
+    /* One line of 16 characters fills the 128 segments. */
+    char line[16 * 4 + 1];
+    const char *cursor = sample;
+    size_t used = 0;
+    for (uint8_t i = 0; i < 16; i++)
+    {
+        const char *next = cursor;
+        i2c_ssd1306_next_glyph(&next);
+        memcpy(&line[used], cursor, next - cursor);
+        used += next - cursor;
+        cursor = next;
+    }
+    line[used] = '\0';
+
+    uint64_t start = bench_now_ns();
+    for (unsigned round = 0; round < rounds * 64; round++)
+        i2c_ssd1306_buffer_text(ssd1306, 0, y, line, round & 1);
+    uint64_t elapsed = bench_now_ns() - start;
+    bench_sink = ssd1306->page[y / 8].segment[0];
+
+    printf("buffer_text  %-10s y=%-2d     %7.1f ns/line  %7.2f ns/char\n", name, y, (double)elapsed / (rounds * 64),
+           (double)elapsed / (rounds * 64 * 16));
+}
+
+/**
+ * @brief Time lookups in a glyph index
+ *
+ * Every codepoint of the index is looked up in a scrambled order, followed by as many codepoints it does not have, and each
+ * result is checked.
+ *
+ * @return Number of wrong results.
+ */
+static int bench_find_glyph(const char *name, const ssd1306_glyph_index_t *index, size_t total, unsigned rounds)
+{
+    uint32_t *codepoints = (uint32_t *)malloc(2 * total * sizeof(uint32_t));
+    if (codepoints == NULL)
+        abort();
+
+    /* A step coprime with the size visits every entry once, in an order the branch predictor cannot follow. */
+    size_t step = 7919 % total;
+    while (step == 0 || total % step == 0)
+        step++;
+    for (size_t i = 0; i < total; i++)
+        codepoints[i] = index[(i * step) % total].codepoint;
+    for (size_t i = 0; i < total; i++)
+        codepoints[total + i] = index[(i * step) % total].codepoint + 1;
+
+    int errors = 0;
+    for (size_t i = 0; i < 2 * total; i++)
+    {
+        const ssd1306_glyph_index_t *entry = i2c_ssd1306_find_glyph(index, total, codepoints[i]);
+        /* The codepoint after an entry may be the next entry, so a miss is only wrong if it finds another codepoint. */
+        if ((entry == NULL && i < total) || (entry != NULL && entry->codepoint != codepoints[i]))
+            errors++;
+    }
+
+    uint32_t sum = 0;
+    uint64_t start = bench_now_ns();
+    for (unsigned round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < 2 * total; i++)
+        {
+            const ssd1306_glyph_index_t *entry = i2c_ssd1306_find_glyph(index, total, codepoints[i]);
+            sum += entry != NULL ? entry->glyph : 1;
+        }
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+    bench_sink = sum;
+
+    double lookup = (double)elapsed / (rounds * 2 * total);
+    printf("find_glyph   %-10s %8zu cps    %7.2f ns/lookup  %5.2f ns/step (log2 %.1f)\n", name, total, lookup,
+           lookup / log2((double)total), log2((double)total));
+    free(codepoints);
+    return errors;
+}
+
+/**
+ * @brief Generate a sorted glyph index
+ *
+ * Codepoints are spread from U+0100 with gaps, so the codepoint after each entry is a miss, and glyphs cycle over font8x8.
+ *
+ * @param total Number of entries.
+ *
+ * @return Allocated index, freed by the caller.
+ */
+static ssd1306_glyph_index_t *bench_generate_index(size_t total)
+{
+    ssd1306_glyph_index_t *index = (ssd1306_glyph_index_t *)malloc(total * sizeof(ssd1306_glyph_index_t));
+    if (index == NULL)
+        abort();
+
+    for (size_t i = 0; i < total; i++)
+    {
+        index[i].codepoint = (uint16_t)(0x0100 + 3 * i);
+        index[i].glyph = (uint16_t)(i % 256);
+    }
+    return index;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned rounds = argc > 1 ? (unsigned)strtoul(argv[1], NULL, 10) : 200;
+    if (rounds == 0)
+    {
+        ESP_LOGE(BENCH_TAG, "Invalid number of rounds '%s'", argv[1]);
+        return 1;
+    }
+
+    bench_next_glyph("ascii", bench_ascii, rounds);
+    bench_next_glyph("cyrillic", bench_cyrillic, rounds);
+
+    i2c_ssd1306_handle_t ssd1306;
+    ssd1306_transport_t *transport;
+    ESP_ERROR_CHECK(ssd1306_transport_new_mock(&transport));
+    ESP_ERROR_CHECK(i2c_ssd1306_init_transport(&ssd1306, transport, &ssd1306_controller_ssd1306, 128, 64, SSD1306_TOP_TO_BOTTOM));
+    bench_buffer_text(&ssd1306, "ascii", bench_ascii, 8, rounds);
+    bench_buffer_text(&ssd1306, "ascii", bench_ascii, 13, rounds);
+    bench_buffer_text(&ssd1306, "cyrillic", bench_cyrillic, 8, rounds);
+    bench_buffer_text(&ssd1306, "cyrillic", bench_cyrillic, 13, rounds);
+    i2c_ssd1306_deinit(&ssd1306);
+
+    /* Every generated index fits the 16-bit codepoints: 0x0100 + 3 * 16383 is below 0x10000. */
+    int errors = bench_find_glyph("font8x8", font8x8_index, sizeof(font8x8_index) / sizeof(font8x8_index[0]), rounds);
+    const size_t sizes[] = {1024, 4096, 16384};
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        ssd1306_glyph_index_t *index = bench_generate_index(sizes[i]);
+        errors += bench_find_glyph("generated", index, sizes[i], rounds);
+        free(index);
+    }
+
+    if (errors != 0)
+    {
+        ESP_LOGE(BENCH_TAG, "%d lookups returned the wrong entry", errors);
+        return 1;
+    }
+    return 0;
+}
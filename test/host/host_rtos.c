@@ -0,0 +1,123 @@
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include <stdlib.h>
+
+/**
+ * Host replacements for FreeRTOS and esp_timer
+ *
+ * Tasks and timers are only recorded, nothing runs in the background. The clock starts at one second, so a timestamp of 0
+ * still means "never" for the driver, and moves only when a test advances it.
+ */
+
+struct host_task
+{
+    TaskFunction_t function;
+    void *arg;
+    uint32_t notifications;
+};
+
+struct host_semaphore
+{
+    bool given;
+};
+
+struct host_timer
+{
+    esp_timer_create_args_t args;
+    uint64_t period_us;
+};
+
+static int64_t host_time_us = 1000000;
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char *name, uint32_t stack_depth, void *arg, UBaseType_t priority, TaskHandle_t *task)
+{
+    struct host_task *host_task = (struct host_task *)calloc(1, sizeof(struct host_task));
+    if (host_task == NULL)
+        return pdFAIL;
+
+    host_task->function = function;
+    host_task->arg = arg;
+    *task = host_task;
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    free(task);
+}
+
+void vTaskSuspend(TaskHandle_t task)
+{
+}
+
+void xTaskNotifyGive(TaskHandle_t task)
+{
+    task->notifications++;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait)
+{
+    return 0;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return (SemaphoreHandle_t)calloc(1, sizeof(struct host_semaphore));
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    semaphore->given = true;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait)
+{
+    semaphore->given = false;
+    return pdTRUE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    free(semaphore);
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return host_time_us;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *create_args, esp_timer_handle_t *timer)
+{
+    struct host_timer *host_timer = (struct host_timer *)calloc(1, sizeof(struct host_timer));
+    if (host_timer == NULL)
+        return ESP_ERR_NO_MEM;
+
+    host_timer->args = *create_args;
+    *timer = host_timer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us)
+{
+    timer->period_us = period_us;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    timer->period_us = 0;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer)
+{
+    free(timer);
+    return ESP_OK;
+}
+
+void host_timer_advance(int64_t us)
+{
+    host_time_us += us;
+}
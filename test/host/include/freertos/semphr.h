@@ -0,0 +1,12 @@
+#pragma once
+
+/* Host replacement for the FreeRTOS semaphores. Without a scheduler nothing can block, so taking always succeeds. */
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_semaphore *SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait);
+void vSemaphoreDelete(SemaphoreHandle_t semaphore);
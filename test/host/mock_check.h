@@ -0,0 +1,60 @@
+#pragma once
+
+#include "ssd1306_transport_mock.h"
+
+/* Checks shared by the host tests that inspect the writes recorded by the mock transport. */
+
+#define MOCK_CHECK_TAG "Host test"
+
+/**
+ * @brief Check one write recorded by the mock transport
+ *
+ * @param name Name of the check, printed on failure.
+ * @param mock Pointer to the mock transport.
+ * @param index Index of the write.
+ * @param data true for a data write.
+ * @param cmd Expected command bytes.
+ * @param cmd_size Number of command bytes.
+ * @param bytes Expected data bytes, NULL for a command write.
+ * @param size Number of data bytes.
+ *
+ * @return Number of failures.
+ */
+static int expect_write(const char *name, const ssd1306_mock_transport_t *mock, size_t index, bool data, const uint8_t *cmd, size_t cmd_size, const uint8_t *bytes, size_t size)
+{
+    if (index >= mock->total_writes)
+    {
+        ESP_LOGE(MOCK_CHECK_TAG, "%s: write %zu missing, %zu recorded", name, index, mock->total_writes);
+        return 1;
+    }
+
+    const ssd1306_mock_write_t *write = &mock->writes[index];
+    if (write->data != data || write->cmd_size != cmd_size || write->size != size ||
+        memcmp(&mock->bytes[write->offset], cmd, cmd_size) != 0 ||
+        (size != 0 && memcmp(&mock->bytes[write->offset + cmd_size], bytes, size) != 0))
+    {
+        ESP_LOGE(MOCK_CHECK_TAG, "%s: write %zu differs, it is a %s write of %zu command and %zu data bytes", name, index,
+                 write->data ? "data" : "command", write->cmd_size, write->size);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Check the number of writes recorded by the mock transport
+ *
+ * @param name Name of the check, printed on failure.
+ * @param mock Pointer to the mock transport.
+ * @param total Expected number of writes.
+ *
+ * @return Number of failures.
+ */
+static int expect_total_writes(const char *name, const ssd1306_mock_transport_t *mock, size_t total)
+{
+    if (mock->total_writes != total)
+    {
+        ESP_LOGE(MOCK_CHECK_TAG, "%s: %zu writes recorded, expected %zu", name, mock->total_writes, total);
+        return 1;
+    }
+    return 0;
+}
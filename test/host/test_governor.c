@@ -0,0 +1,211 @@
+#include "ssd1306_governor.h"
+#include "ssd1306_cmd.h"
+#include "mock_check.h"
+
+/**
+ * Governor test
+ *
+ * Runs i2c_ssd1306_governor_poll() on a handle backed by the mock transport, moving the host clock by hand, and checks when the
+ * changes are flushed, which power commands are sent and what the statistics count.
+ */
+
+#define TEST_TAG "Governor test"
+
+static const ssd1306_governor_config_t test_config = {
+    .max_fps = 50,
+    .latency_ms = 5,
+    .dim_timeout_ms = 1000,
+    .sleep_timeout_ms = 3000,
+    .contrast = 0xCF,
+    .dim_contrast = 0x10};
+
+/**
+ * @brief Check a value returned by the governor
+ *
+ * @return Number of failures.
+ */
+static int expect_value(const char *name, long long value, long long expected)
+{
+    if (value != expected)
+    {
+        ESP_LOGE(TEST_TAG, "%s: %lld, expected %lld", name, value, expected);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Check the flush timing
+ *
+ * The first poll sends the whole buffer. A change is then held back by the 20 ms frame cap at most 5 ms, the latency budget,
+ * and changes made meanwhile share its flush. A change made once the cap allows it is flushed by the same poll.
+ *
+ * @return Number of failures.
+ */
+static int check_flush(i2c_ssd1306_governor_handle_t *governor, ssd1306_mock_transport_t *mock)
+{
+    i2c_ssd1306_handle_t *ssd1306 = governor->i2c_ssd1306;
+    int failures = 0;
+
+    ssd1306_transport_mock_clear(&mock->base);
+    failures += expect_value("first poll wait", i2c_ssd1306_governor_poll(governor), 20000);
+    failures += expect_total_writes("first poll", mock, ssd1306->total_pages);
+    failures += expect_value("first poll flushes", governor->stats.flushes, 1);
+
+    ssd1306_transport_mock_clear(&mock->base);
+    host_timer_advance(1000);
+    failures += expect_value("unchanged poll wait", i2c_ssd1306_governor_poll(governor), 20000);
+    failures += expect_total_writes("unchanged poll", mock, 0);
+
+    host_timer_advance(1000);
+    i2c_ssd1306_buffer_fill_pixel(ssd1306, 3, 2, true);
+    failures += expect_value("held change wait", i2c_ssd1306_governor_poll(governor), 5000);
+    host_timer_advance(2000);
+    i2c_ssd1306_buffer_fill_pixel(ssd1306, 6, 2, true);
+    failures += expect_value("batched change wait", i2c_ssd1306_governor_poll(governor), 3000);
+    failures += expect_total_writes("held change", mock, 0);
+
+    host_timer_advance(3000);
+    failures += expect_value("latency flush wait", i2c_ssd1306_governor_poll(governor), 20000);
+    failures += expect_total_writes("latency flush", mock, 1);
+    failures += expect_value("latency flush flushes", governor->stats.flushes, 2);
+    if (mock->total_writes == 1 && (mock->writes[0].size == 0 || mock->writes[0].size > 8))
+    {
+        ESP_LOGE(TEST_TAG, "latency flush: %zu bytes sent for two nearby pixels", mock->writes[0].size);
+        failures++;
+    }
+
+    ssd1306_transport_mock_clear(&mock->base);
+    host_timer_advance(30000);
+    i2c_ssd1306_buffer_fill_pixel(ssd1306, 100, 60, true);
+    failures += expect_value("immediate flush wait", i2c_ssd1306_governor_poll(governor), 20000);
+    failures += expect_total_writes("immediate flush", mock, 1);
+    failures += expect_value("immediate flush flushes", governor->stats.flushes, 3);
+
+    if (failures == 0)
+        printf("PASS flush\n");
+    return failures;
+}
+
+/**
+ * @brief Check the dim and sleep transitions
+ *
+ * The display dims after 1 s without changes and sleeps after 3 s. The next change wakes it up at full contrast before its
+ * flush, in the same poll.
+ *
+ * @return Number of failures.
+ */
+static int check_power(i2c_ssd1306_governor_handle_t *governor, ssd1306_mock_transport_t *mock)
+{
+    const uint8_t dim_cmd[] = {OLED_CMD_SET_CONTRAST_CONTROL, 0x10, OLED_CMD_DISPLAY_ON};
+    const uint8_t sleep_cmd[] = {OLED_CMD_DISPLAY_OFF};
+    const uint8_t wake_cmd[] = {OLED_CMD_SET_CONTRAST_CONTROL, 0xCF, OLED_CMD_DISPLAY_ON};
+    int failures = 0;
+
+    ssd1306_transport_mock_clear(&mock->base);
+    host_timer_advance(999000);
+    i2c_ssd1306_governor_poll(governor);
+    failures += expect_total_writes("before dim", mock, 0);
+    failures += expect_value("before dim state", governor->state, SSD1306_POWER_ACTIVE);
+
+    host_timer_advance(1000);
+    i2c_ssd1306_governor_poll(governor);
+    failures += expect_total_writes("dim", mock, 1);
+    failures += expect_write("dim", mock, 0, false, dim_cmd, sizeof(dim_cmd), NULL, 0);
+    failures += expect_value("dim state", governor->state, SSD1306_POWER_DIM);
+
+    ssd1306_transport_mock_clear(&mock->base);
+    host_timer_advance(1000000);
+    i2c_ssd1306_governor_poll(governor);
+    failures += expect_total_writes("still dim", mock, 0);
+    host_timer_advance(1000000);
+    i2c_ssd1306_governor_poll(governor);
+    failures += expect_total_writes("sleep", mock, 1);
+    failures += expect_write("sleep", mock, 0, false, sleep_cmd, sizeof(sleep_cmd), NULL, 0);
+    failures += expect_value("sleep state", governor->state, SSD1306_POWER_SLEEP);
+
+    ssd1306_transport_mock_clear(&mock->base);
+    host_timer_advance(5000000);
+    i2c_ssd1306_governor_poll(governor);
+    failures += expect_total_writes("asleep", mock, 0);
+
+    i2c_ssd1306_buffer_fill_pixel(governor->i2c_ssd1306, 64, 32, true);
+    i2c_ssd1306_governor_poll(governor);
+    failures += expect_total_writes("wake", mock, 2);
+    failures += expect_write("wake", mock, 0, false, wake_cmd, sizeof(wake_cmd), NULL, 0);
+    if (mock->total_writes == 2 && !mock->writes[1].data)
+    {
+        ESP_LOGE(TEST_TAG, "wake: the change is not flushed after waking up");
+        failures++;
+    }
+    failures += expect_value("wake state", governor->state, SSD1306_POWER_ACTIVE);
+
+    if (failures == 0)
+        printf("PASS power\n");
+    return failures;
+}
+
+/**
+ * @brief Check the statistics
+ *
+ * A failed power command is not counted as a transmission and leaves the state unchanged. Resetting starts a new measurement
+ * period.
+ *
+ * @return Number of failures.
+ */
+static int check_stats(i2c_ssd1306_governor_handle_t *governor, ssd1306_mock_transport_t *mock)
+{
+    int failures = 0;
+    ssd1306_governor_stats_t stats;
+    i2c_ssd1306_governor_get_stats(governor, &stats);
+
+    /* init: 1 wake command. Flushes: 8 full pages, 1, 1. Power: dim, sleep, wake and 1 flush. */
+    failures += expect_value("transmissions", stats.transmissions, 1 + 8 + 1 + 1 + 3 + 1);
+    failures += expect_value("flushes", stats.flushes, 4);
+    failures += expect_value("polls", stats.polls, 12);
+
+    mock->error = ESP_FAIL;
+    failures += expect_value("failed sleep", i2c_ssd1306_governor_set_state(governor, SSD1306_POWER_SLEEP), ESP_FAIL);
+    mock->error = ESP_OK;
+    failures += expect_value("failed sleep transmissions", governor->stats.transmissions, stats.transmissions);
+    failures += expect_value("failed sleep state", governor->state, SSD1306_POWER_ACTIVE);
+
+    i2c_ssd1306_governor_reset_stats(governor);
+    host_timer_advance(1000);
+    failures += expect_value("reset flushes", governor->stats.flushes, 0);
+    failures += expect_value("reset since", governor->stats.since_us, esp_timer_get_time() - 1000);
+    if (i2c_ssd1306_governor_duty_cycle(governor) != 0.0f)
+    {
+        ESP_LOGE(TEST_TAG, "reset: duty cycle is not 0 without any transfer");
+        failures++;
+    }
+
+    if (failures == 0)
+        printf("PASS stats\n");
+    return failures;
+}
+
+int main(void)
+{
+    i2c_ssd1306_handle_t ssd1306;
+    ssd1306_transport_t *transport;
+    ESP_ERROR_CHECK(ssd1306_transport_new_mock(&transport));
+    ESP_ERROR_CHECK(i2c_ssd1306_init_transport(&ssd1306, transport, &ssd1306_controller_ssd1306, 128, 64, SSD1306_TOP_TO_BOTTOM));
+    ssd1306_mock_transport_t *mock = (ssd1306_mock_transport_t *)transport;
+
+    const uint8_t wake_cmd[] = {OLED_CMD_SET_CONTRAST_CONTROL, 0xCF, OLED_CMD_DISPLAY_ON};
+    i2c_ssd1306_governor_handle_t governor;
+    ssd1306_transport_mock_clear(transport);
+    ESP_ERROR_CHECK(i2c_ssd1306_governor_init(&governor, &ssd1306, &test_config));
+    int failures = expect_total_writes("init", mock, 1);
+    failures += expect_write("init", mock, 0, false, wake_cmd, sizeof(wake_cmd), NULL, 0);
+
+    failures += check_flush(&governor, mock);
+    failures += check_power(&governor, mock);
+    failures += check_stats(&governor, mock);
+
+    i2c_ssd1306_governor_deinit(&governor);
+    i2c_ssd1306_deinit(&ssd1306);
+    printf("%d failed\n", failures);
+    return failures == 0 ? 0 : 1;
+}
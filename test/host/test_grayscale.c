@@ -0,0 +1,164 @@
+#include "ssd1306_grayscale.h"
+#include "ssd1306_cmd.h"
+#include "mock_check.h"
+
+/**
+ * Grayscale scheduler test
+ *
+ * Drives the bit-plane cycle with i2c_ssd1306_grayscale_subframe() on a handle backed by the mock transport, and checks the
+ * exact writes of each subframe: the page window of the changed pages, the plane data, and the contrast of the plane sent
+ * after its data.
+ */
+
+#define TEST_TAG "Grayscale test"
+
+/**
+ * @brief Check the binary weighted planes and their contrasts
+ *
+ * Level 1 is lit in plane 0 only, level 2 in plane 1 only and level 3 in both, each on its own page. Plane 0 is shown at half
+ * the contrast of plane 1, and only pages 0 and 1 differ between the planes.
+ *
+ * @return Number of failures.
+ */
+static int check_contrast_mode(void)
+{
+    i2c_ssd1306_handle_t ssd1306;
+    ssd1306_transport_t *transport;
+    ESP_ERROR_CHECK(ssd1306_transport_new_mock(&transport));
+    ESP_ERROR_CHECK(i2c_ssd1306_init_transport(&ssd1306, transport, &ssd1306_controller_ssd1306, 128, 64, SSD1306_TOP_TO_BOTTOM));
+    ssd1306_mock_transport_t *mock = (ssd1306_mock_transport_t *)transport;
+
+    i2c_ssd1306_grayscale_handle_t grayscale;
+    ESP_ERROR_CHECK(i2c_ssd1306_grayscale_init(&grayscale, &ssd1306, 4, SSD1306_GRAYSCALE_CONTRAST, 0xFF));
+    i2c_ssd1306_grayscale_fill_space(&grayscale, 0, 31, 0, 7, 1);
+    i2c_ssd1306_grayscale_fill_space(&grayscale, 32, 63, 8, 15, 2);
+    i2c_ssd1306_grayscale_fill_space(&grayscale, 64, 95, 16, 23, 3);
+    const uint8_t *plane0 = grayscale.planes;
+    const uint8_t *plane1 = grayscale.planes + grayscale.plane_size;
+
+    int failures = 0;
+    if (grayscale.total_planes != 2 || plane0[0] != 0xFF || plane1[0] != 0x00 || plane0[128 + 32] != 0x00 || plane1[128 + 32] != 0xFF ||
+        plane0[256 + 64] != 0xFF || plane1[256 + 64] != 0xFF)
+    {
+        ESP_LOGE(TEST_TAG, "contrast: levels are not split into binary weighted planes");
+        failures++;
+    }
+
+    const uint8_t mode_cmd[] = {OLED_CMD_SET_MEMORY_ADDR_MODE, 0x00};
+    const uint8_t full_cmd[] = {OLED_CMD_SET_COLUMN_ADDR_RANGE, 0x00, 127, OLED_CMD_SET_PAGE_ADDR_RANGE, 0, 7};
+    const uint8_t changed_cmd[] = {OLED_CMD_SET_COLUMN_ADDR_RANGE, 0x00, 127, OLED_CMD_SET_PAGE_ADDR_RANGE, 0, 1};
+    const uint8_t low_contrast_cmd[] = {OLED_CMD_SET_CONTRAST_CONTROL, 0x7F};
+    const uint8_t high_contrast_cmd[] = {OLED_CMD_SET_CONTRAST_CONTROL, 0xFF};
+
+    ssd1306_transport_mock_clear(transport);
+    ESP_ERROR_CHECK(i2c_ssd1306_grayscale_start(&grayscale, 60, 1));
+    failures += expect_total_writes("contrast start", mock, 3);
+    failures += expect_write("contrast start", mock, 0, false, mode_cmd, sizeof(mode_cmd), NULL, 0);
+    failures += expect_write("contrast start", mock, 1, true, full_cmd, sizeof(full_cmd), plane0, 1024);
+    failures += expect_write("contrast start", mock, 2, false, low_contrast_cmd, sizeof(low_contrast_cmd), NULL, 0);
+
+    /* Only the pages that differ from plane 0 are sent, then the contrast of plane 1 once its data is in RAM. */
+    ssd1306_transport_mock_clear(transport);
+    ESP_ERROR_CHECK(i2c_ssd1306_grayscale_subframe(&grayscale));
+    failures += expect_total_writes("contrast plane 1", mock, 2);
+    failures += expect_write("contrast plane 1", mock, 0, true, changed_cmd, sizeof(changed_cmd), plane1, 256);
+    failures += expect_write("contrast plane 1", mock, 1, false, high_contrast_cmd, sizeof(high_contrast_cmd), NULL, 0);
+
+    ssd1306_transport_mock_clear(transport);
+    ESP_ERROR_CHECK(i2c_ssd1306_grayscale_subframe(&grayscale));
+    failures += expect_total_writes("contrast plane 0", mock, 2);
+    failures += expect_write("contrast plane 0", mock, 0, true, changed_cmd, sizeof(changed_cmd), plane0, 256);
+    failures += expect_write("contrast plane 0", mock, 1, false, low_contrast_cmd, sizeof(low_contrast_cmd), NULL, 0);
+
+    ssd1306_grayscale_stats_t stats;
+    i2c_ssd1306_grayscale_get_stats(&grayscale, &stats);
+    size_t expected_bytes = sizeof(full_cmd) + 1024 + 2 + 2 * (sizeof(changed_cmd) + 256 + 2);
+    if (stats.subframes != 2 || stats.transfer_bytes != expected_bytes)
+    {
+        ESP_LOGE(TEST_TAG, "contrast: %lu subframes and %lu bytes, expected 2 and %zu", (unsigned long)stats.subframes, (unsigned long)stats.transfer_bytes, expected_bytes);
+        failures++;
+    }
+
+    /* Stopping restores page addressing and the full contrast before the monochrome buffer is sent back. */
+    const uint8_t restore_cmd[] = {OLED_CMD_SET_MEMORY_ADDR_MODE, 0x02, OLED_CMD_SET_CONTRAST_CONTROL, 0xFF};
+    ssd1306_transport_mock_clear(transport);
+    ESP_ERROR_CHECK(i2c_ssd1306_grayscale_stop(&grayscale));
+    failures += expect_write("contrast stop", mock, 0, false, restore_cmd, sizeof(restore_cmd), NULL, 0);
+    if (grayscale.running || grayscale.task != NULL || grayscale.stopped != NULL || grayscale.timer != NULL)
+    {
+        ESP_LOGE(TEST_TAG, "contrast stop: scheduler not released");
+        failures++;
+    }
+
+    if (failures == 0)
+        printf("PASS contrast\n");
+    i2c_ssd1306_grayscale_deinit(&grayscale);
+    i2c_ssd1306_deinit(&ssd1306);
+    return failures;
+}
+
+/**
+ * @brief Check the thermometer coded planes
+ *
+ * Every FRC plane shares the contrast sent when the scheduler starts, so subframes carry no contrast command, and a plane equal
+ * to the RAM is not sent at all.
+ *
+ * @return Number of failures.
+ */
+static int check_frc_mode(void)
+{
+    i2c_ssd1306_handle_t ssd1306;
+    ssd1306_transport_t *transport;
+    ESP_ERROR_CHECK(ssd1306_transport_new_mock(&transport));
+    ESP_ERROR_CHECK(i2c_ssd1306_init_transport(&ssd1306, transport, &ssd1306_controller_ssd1306, 128, 64, SSD1306_TOP_TO_BOTTOM));
+    ssd1306_mock_transport_t *mock = (ssd1306_mock_transport_t *)transport;
+
+    i2c_ssd1306_grayscale_handle_t grayscale;
+    ESP_ERROR_CHECK(i2c_ssd1306_grayscale_init(&grayscale, &ssd1306, 4, SSD1306_GRAYSCALE_FRC, 0x80));
+    i2c_ssd1306_grayscale_fill_space(&grayscale, 10, 20, 3, 50, 3);
+
+    const uint8_t contrast_cmd[] = {OLED_CMD_SET_CONTRAST_CONTROL, 0x80};
+    ssd1306_transport_mock_clear(transport);
+    ESP_ERROR_CHECK(i2c_ssd1306_grayscale_start(&grayscale, 60, 1));
+    int failures = 0;
+    failures += expect_total_writes("frc start", mock, 3);
+    failures += expect_write("frc start", mock, 2, false, contrast_cmd, sizeof(contrast_cmd), NULL, 0);
+
+    /* Level 3 is lit in all three planes, so the cycle sends nothing. */
+    ssd1306_transport_mock_clear(transport);
+    for (uint8_t i = 0; i < 3; i++)
+        ESP_ERROR_CHECK(i2c_ssd1306_grayscale_subframe(&grayscale));
+    failures += expect_total_writes("frc identical planes", mock, 0);
+
+    /* A level 1 pixel is only lit in plane 0: planes 1 and 2 match the RAM, plane 0 and then plane 1 send page 5. */
+    i2c_ssd1306_grayscale_fill_pixel(&grayscale, 100, 40, 1);
+    const uint8_t page_cmd[] = {OLED_CMD_SET_COLUMN_ADDR_RANGE, 0x00, 127, OLED_CMD_SET_PAGE_ADDR_RANGE, 5, 5};
+    const uint8_t *plane0 = grayscale.planes;
+    const uint8_t *plane1 = grayscale.planes + grayscale.plane_size;
+    ssd1306_transport_mock_clear(transport);
+    for (uint8_t i = 0; i < 4; i++)
+        ESP_ERROR_CHECK(i2c_ssd1306_grayscale_subframe(&grayscale));
+    failures += expect_total_writes("frc level 1", mock, 2);
+    failures += expect_write("frc level 1", mock, 0, true, page_cmd, sizeof(page_cmd), &plane0[5 * 128], 128);
+    failures += expect_write("frc level 1", mock, 1, true, page_cmd, sizeof(page_cmd), &plane1[5 * 128], 128);
+    if (plane0[5 * 128 + 100] != 0x01 || plane1[5 * 128 + 100] != 0x00)
+    {
+        ESP_LOGE(TEST_TAG, "frc: level 1 pixel is not lit in plane 0 only");
+        failures++;
+    }
+
+    ESP_ERROR_CHECK(i2c_ssd1306_grayscale_stop(&grayscale));
+    if (failures == 0)
+        printf("PASS frc\n");
+    i2c_ssd1306_grayscale_deinit(&grayscale);
+    i2c_ssd1306_deinit(&ssd1306);
+    return failures;
+}
+
+int main(void)
+{
+    int failures = check_contrast_mode();
+    failures += check_frc_mode();
+    printf("%d failed\n", failures);
+    return failures == 0 ? 0 : 1;
+}
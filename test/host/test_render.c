@@ -0,0 +1,686 @@
+#include "ssd1306_driver.h"
+#include "ssd1306_cmd.h"
+#include "mock_check.h"
+
+/**
+ * Render regression suite
+ *
+ * Each scene draws through the i2c_ssd1306_buffer_* functions on a handle backed by the mock transport and is compared byte
+ * by byte with its golden framebuffer in golden_frames.h. A difference is printed as ASCII by i2c_ssd1306_buffer_compare().
+ *
+ *     test_render           Run every scene, exit status 1 if any differs.
+ *     test_render --print   Print every scene, to check the frames by eye.
+ *     test_render --update  Print golden_frames.h for the current output.
+ */
+
+#define TEST_TAG "Render test"
+
+static const uint8_t esp_logo_img[4][32] = {
+    {0x00, 0x00, 0x00, 0xC0, 0x60, 0x18, 0x00, 0x00, 0x70, 0x78, 0x78, 0x78, 0xF8, 0xF8, 0xF0, 0xF0,
+     0xF2, 0xE6, 0xE6, 0xCE, 0x9E, 0x9C, 0x3C, 0x78, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00},
+    {0x00, 0xFC, 0x07, 0x60, 0xF8, 0xFC, 0xFE, 0xFE, 0x9E, 0x9E, 0x9E, 0x3E, 0x3E, 0x7C, 0x7C, 0xF9,
+     0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3F, 0x7E, 0xFC, 0xF8, 0xE1, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00},
+    {0x00, 0x3F, 0xE0, 0x00, 0x03, 0x0F, 0x1F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xF1, 0xE3,
+     0xC7, 0x9F, 0x3F, 0x7F, 0xFF, 0xFE, 0xF8, 0xF1, 0xE3, 0xC7, 0x9F, 0x3F, 0xFF, 0x3F, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x0D, 0x19, 0x11, 0x30, 0x20, 0x24, 0x4F, 0x4F, 0x4F,
+     0x4F, 0x40, 0x40, 0x4F, 0x4F, 0x6F, 0x27, 0x20, 0x10, 0x10, 0x08, 0x0C, 0x04, 0x00, 0x00, 0x00},
+};
+
+/* esp_logo_img compressed by ImageToCArray.py -c. */
+static const uint8_t esp_logo_rle[122] = {
+    0x82, 0x00, 0x05, 0xC0, 0x60, 0x18, 0x00, 0x00, 0x70, 0x82, 0x78, 0x10, 0xF8, 0xF8, 0xF0, 0xF0,
+    0xF2, 0xE6, 0xE6, 0xCE, 0x9E, 0x9C, 0x3C, 0x78, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x83, 0x00, 0x06,
+    0xFC, 0x07, 0x60, 0xF8, 0xFC, 0xFE, 0xFE, 0x82, 0x9E, 0x12, 0x3E, 0x3E, 0x7C, 0x7C, 0xF9, 0xF9,
+    0xF3, 0xE7, 0xCF, 0x9F, 0x3F, 0x7E, 0xFC, 0xF8, 0xE1, 0x07, 0xFF, 0xFF, 0xFC, 0x82, 0x00, 0x1C,
+    0x3F, 0xE0, 0x00, 0x03, 0x0F, 0x1F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xF1, 0xE3, 0xC7,
+    0x9F, 0x3F, 0x7F, 0xFF, 0xFE, 0xF8, 0xF1, 0xE3, 0xC7, 0x9F, 0x3F, 0xFF, 0x3F, 0x85, 0x00, 0x08,
+    0x01, 0x03, 0x06, 0x0D, 0x19, 0x11, 0x30, 0x20, 0x24, 0x83, 0x4F, 0x0B, 0x40, 0x40, 0x4F, 0x4F,
+    0x6F, 0x27, 0x20, 0x10, 0x10, 0x08, 0x0C, 0x04, 0x82, 0x00};
+
+static void scene_pixels(i2c_ssd1306_handle_t *ssd1306)
+{
+    i2c_ssd1306_buffer_fill_pixel(ssd1306, 0, 0, true);
+    i2c_ssd1306_buffer_fill_pixel(ssd1306, 127, 0, true);
+    i2c_ssd1306_buffer_fill_pixel(ssd1306, 0, 63, true);
+    i2c_ssd1306_buffer_fill_pixel(ssd1306, 127, 63, true);
+    for (uint8_t i = 4; i < 60; i++)
+        i2c_ssd1306_buffer_fill_pixel(ssd1306, 2 * i, i, true);
+    for (uint8_t i = 0; i < 64; i += 3)
+        i2c_ssd1306_buffer_fill_pixel(ssd1306, 100, i, true);
+    i2c_ssd1306_buffer_fill_pixel(ssd1306, 100, 9, false);
+    /* Out of the display, rejected without drawing. */
+    i2c_ssd1306_buffer_fill_pixel(ssd1306, 128, 0, true);
+    i2c_ssd1306_buffer_fill_pixel(ssd1306, 0, 64, true);
+}
+
+static void scene_spaces(i2c_ssd1306_handle_t *ssd1306)
+{
+    /* Two partial pages, inside one page, exactly one page, and many pages with both ends partial. */
+    i2c_ssd1306_buffer_fill_space(ssd1306, 5, 20, 3, 12, true);
+    i2c_ssd1306_buffer_fill_space(ssd1306, 30, 40, 17, 21, true);
+    i2c_ssd1306_buffer_fill_space(ssd1306, 50, 60, 24, 31, true);
+    i2c_ssd1306_buffer_fill_space(ssd1306, 70, 120, 2, 61, true);
+    i2c_ssd1306_buffer_fill_space(ssd1306, 75, 115, 10, 50, false);
+    i2c_ssd1306_buffer_fill_space(ssd1306, 0, 127, 63, 63, true);
+    i2c_ssd1306_buffer_fill_space(ssd1306, 0, 0, 0, 63, true);
+    /* Reversed and out of the display, rejected without drawing. */
+    i2c_ssd1306_buffer_fill_space(ssd1306, 20, 10, 0, 7, true);
+    i2c_ssd1306_buffer_fill_space(ssd1306, 0, 128, 0, 7, true);
+}
+
+static void scene_fill_invert(i2c_ssd1306_handle_t *ssd1306)
+{
+    i2c_ssd1306_buffer_fill(ssd1306, true);
+    i2c_ssd1306_buffer_fill_space(ssd1306, 8, 119, 8, 55, false);
+    i2c_ssd1306_buffer_text(ssd1306, 16, 16, "INVERT", true);
+    i2c_ssd1306_buffer_text(ssd1306, 16, 27, "inverted", true);
+    i2c_ssd1306_buffer_text(ssd1306, 16, 40, "normal", false);
+}
+
+static void scene_text(i2c_ssd1306_handle_t *ssd1306)
+{
+    i2c_ssd1306_buffer_text(ssd1306, 0, 0, "Hello, world!", false);
+    i2c_ssd1306_buffer_text(ssd1306, 3, 13, "unaligned y", false);
+    i2c_ssd1306_buffer_text(ssd1306, 0, 27, "~!@#$%^&*()_+{}", false);
+    /* Clipped at the right edge: the characters that fit are drawn. */
+    i2c_ssd1306_buffer_text(ssd1306, 104, 40, "clip", false);
+    i2c_ssd1306_buffer_text(ssd1306, 100, 47, "clip", true);
+    i2c_ssd1306_buffer_text(ssd1306, 0, 56, "bottom", false);
+    /* Unaligned on the last page, rejected without drawing. */
+    i2c_ssd1306_buffer_text(ssd1306, 64, 59, "none", false);
+}
+
+static void scene_numbers(i2c_ssd1306_handle_t *ssd1306)
+{
+    i2c_ssd1306_buffer_int(ssd1306, 0, 0, -12345, false);
+    i2c_ssd1306_buffer_int(ssd1306, 64, 0, 0, true);
+    i2c_ssd1306_buffer_int(ssd1306, 0, 11, 2147483647, false);
+    i2c_ssd1306_buffer_float(ssd1306, 0, 24, 3.14159f, 2, false);
+    i2c_ssd1306_buffer_float(ssd1306, 64, 24, -0.5f, 1, true);
+    i2c_ssd1306_buffer_float(ssd1306, 0, 37, 1000.0f, 0, false);
+    i2c_ssd1306_buffer_float(ssd1306, 0, 48, -273.15f, 3, false);
+}
+
+static void scene_image(i2c_ssd1306_handle_t *ssd1306)
+{
+    const uint8_t *logo = (const uint8_t *)esp_logo_img;
+    i2c_ssd1306_buffer_image(ssd1306, 0, 0, logo, 32, 32, false);
+    i2c_ssd1306_buffer_image(ssd1306, 33, 5, logo, 32, 32, false);
+    i2c_ssd1306_buffer_image(ssd1306, 66, 0, logo, 32, 32, true);
+    i2c_ssd1306_buffer_image(ssd1306, 0, 35, logo, 32, 16, true);
+    i2c_ssd1306_buffer_image(ssd1306, 96, 32, logo, 32, 32, false);
+    /* Past the right edge, rejected without drawing. */
+    i2c_ssd1306_buffer_image(ssd1306, 100, 0, logo, 32, 32, false);
+}
+
+static void scene_image_rle(i2c_ssd1306_handle_t *ssd1306)
+{
+    /* Same calls as scene_image on the compressed logo, so it shares its golden frame. */
+    i2c_ssd1306_buffer_image_rle(ssd1306, 0, 0, esp_logo_rle, sizeof(esp_logo_rle), 32, 32, false);
+    i2c_ssd1306_buffer_image_rle(ssd1306, 33, 5, esp_logo_rle, sizeof(esp_logo_rle), 32, 32, false);
+    i2c_ssd1306_buffer_image_rle(ssd1306, 66, 0, esp_logo_rle, sizeof(esp_logo_rle), 32, 32, true);
+    i2c_ssd1306_buffer_image_rle(ssd1306, 0, 35, esp_logo_rle, sizeof(esp_logo_rle), 32, 16, true);
+    i2c_ssd1306_buffer_image_rle(ssd1306, 96, 32, esp_logo_rle, sizeof(esp_logo_rle), 32, 32, false);
+    i2c_ssd1306_buffer_image_rle(ssd1306, 100, 0, esp_logo_rle, sizeof(esp_logo_rle), 32, 32, false);
+}
+
+/**
+ * @brief Draw the canvas the viewport scenes look into
+ *
+ * A frame around a 160x96 canvas, a diagonal and text on unaligned rows, so every window shows an edge and a shift.
+ */
+static void draw_canvas(i2c_ssd1306_handle_t *canvas)
+{
+    i2c_ssd1306_buffer_fill_space(canvas, 0, 159, 0, 0, true);
+    i2c_ssd1306_buffer_fill_space(canvas, 0, 159, 95, 95, true);
+    i2c_ssd1306_buffer_fill_space(canvas, 0, 0, 0, 95, true);
+    i2c_ssd1306_buffer_fill_space(canvas, 159, 159, 0, 95, true);
+    for (uint8_t i = 0; i < 96; i++)
+        i2c_ssd1306_buffer_fill_pixel(canvas, i + 32, i, true);
+    i2c_ssd1306_buffer_text(canvas, 4, 4, "Canvas 160x96", false);
+    i2c_ssd1306_buffer_text(canvas, 20, 45, "middle", true);
+    i2c_ssd1306_buffer_text(canvas, 60, 83, "bottom right", false);
+}
+
+static void scene_viewport(i2c_ssd1306_handle_t *ssd1306, uint8_t x, uint8_t y)
+{
+    i2c_ssd1306_handle_t canvas;
+    ESP_ERROR_CHECK(i2c_ssd1306_canvas_init(&canvas, 160, 96));
+    draw_canvas(&canvas);
+    i2c_ssd1306_buffer_viewport(ssd1306, &canvas, x, y);
+    i2c_ssd1306_canvas_deinit(&canvas);
+}
+
+static void scene_viewport_aligned(i2c_ssd1306_handle_t *ssd1306)
+{
+    scene_viewport(ssd1306, 16, 8);
+}
+
+static void scene_viewport_unaligned(i2c_ssd1306_handle_t *ssd1306)
+{
+    scene_viewport(ssd1306, 32, 29);
+}
+
+static void scene_utf8(i2c_ssd1306_handle_t *ssd1306)
+{
+    i2c_ssd1306_buffer_text(ssd1306, 0, 0, "Привет, мир", false);
+    i2c_ssd1306_buffer_text(ssd1306, 0, 10, "Ωμέγα αβγδ", false);
+    i2c_ssd1306_buffer_text(ssd1306, 0, 19, "café naïve ß", true);
+    /* Unsupported codepoint, stray continuation byte and truncated sequence, each drawn as '?'. Then an overlong form and a
+     * surrogate, whose lead byte and continuation bytes are drawn as a '?' each. */
+    i2c_ssd1306_buffer_text(ssd1306, 0, 32, "\xe2\x82\xac \x80 \xc3 \xe0\x80\xaf\xed\xa0\x80", false);
+    i2c_ssd1306_buffer_text(ssd1306, 0, 44, "┌──┐░▒▓█", false);
+    i2c_ssd1306_buffer_text(ssd1306, 0, 56, "└──┘ЖЯЁ", false);
+    /* Overlong form of U+FFFF and U+110000, above the last codepoint: 4 '?' each. */
+    i2c_ssd1306_buffer_text(ssd1306, 64, 56, "\xf0\x8f\xbf\xbf\xf4\x90\x80\x80", false);
+}
+
+static void scene_rotation(i2c_ssd1306_handle_t *ssd1306)
+{
+    ESP_ERROR_CHECK(i2c_ssd1306_set_orientation(ssd1306, SSD1306_ROTATION_90, false, false));
+    i2c_ssd1306_buffer_text(ssd1306, 0, 0, "Rot 90", false);
+    i2c_ssd1306_buffer_fill_space(ssd1306, 4, 59, 20, 23, true);
+    i2c_ssd1306_buffer_int(ssd1306, 8, 61, 64, false);
+    i2c_ssd1306_buffer_text(ssd1306, 0, 120, "128", true);
+}
+
+/**
+ * @brief Scene of the suite
+ *
+ * - name: Name of the scene, also the name of its golden frame.
+ * - draw: Draws the scene on a cleared 128x64 display.
+ * - golden: Golden framebuffer, in page order.
+ * - golden_size: Size of the golden framebuffer, the size of the buffer after drawing.
+ */
+typedef struct
+{
+    const char *name;
+    void (*draw)(i2c_ssd1306_handle_t *ssd1306);
+    const uint8_t *golden;
+    size_t golden_size;
+} render_scene_t;
+
+#include "golden_frames.h"
+
+#define SCENE(name, golden) {#name, scene_##name, golden, sizeof(golden)}
+
+static const render_scene_t scenes[] = {
+    SCENE(pixels, golden_pixels),
+    SCENE(spaces, golden_spaces),
+    SCENE(fill_invert, golden_fill_invert),
+    SCENE(text, golden_text),
+    SCENE(numbers, golden_numbers),
+    SCENE(image, golden_image),
+    SCENE(image_rle, golden_image),
+    SCENE(viewport_aligned, golden_viewport_aligned),
+    SCENE(viewport_unaligned, golden_viewport_unaligned),
+    SCENE(utf8, golden_utf8),
+    SCENE(rotation, golden_rotation),
+};
+
+/**
+ * @brief Draw a scene on a new display backed by the mock transport
+ */
+static void render(const render_scene_t *scene, i2c_ssd1306_handle_t *ssd1306)
+{
+    ssd1306_transport_t *transport;
+    ESP_ERROR_CHECK(ssd1306_transport_new_mock(&transport));
+    ESP_ERROR_CHECK(i2c_ssd1306_init_transport(ssd1306, transport, &ssd1306_controller_ssd1306, 128, 64, SSD1306_TOP_TO_BOTTOM));
+    scene->draw(ssd1306);
+}
+
+/**
+ * @brief Print the golden frame of a scene as a C array
+ */
+static void print_golden(const render_scene_t *scene, i2c_ssd1306_handle_t *ssd1306)
+{
+    printf("/* %s: %dx%d */\n", scene->name, ssd1306->width, ssd1306->height);
+    printf("static const uint8_t golden_%s[%d] = {", scene->name, ssd1306->total_pages * ssd1306->width);
+    for (uint16_t i = 0; i < ssd1306->total_pages * ssd1306->width; i++)
+    {
+        if (i % 16 == 0)
+            printf("\n    ");
+        else
+            printf(" ");
+        printf("0x%02X,", ssd1306->page[i / ssd1306->width].segment[i % ssd1306->width]);
+    }
+    printf("\n};\n\n");
+}
+
+/**
+ * @brief Check the bytes the driver sends to the RAM for a queued span
+ *
+ * After a full frame in horizontal addressing, a span goes back to page addressing and only carries its own segments.
+ *
+ * @return Number of failures.
+ */
+static int check_transfer(void)
+{
+    i2c_ssd1306_handle_t ssd1306;
+    ssd1306_transport_t *transport;
+    ESP_ERROR_CHECK(ssd1306_transport_new_mock(&transport));
+    ESP_ERROR_CHECK(i2c_ssd1306_init_transport(&ssd1306, transport, &ssd1306_controller_ssd1306, 128, 64, SSD1306_TOP_TO_BOTTOM));
+    ssd1306_mock_transport_t *mock = (ssd1306_mock_transport_t *)transport;
+
+    i2c_ssd1306_pages_to_ram(&ssd1306);
+    ssd1306_transport_mock_clear(transport);
+    i2c_ssd1306_buffer_text(&ssd1306, 26, 16, "ok", false);
+    i2c_ssd1306_queue_segments(&ssd1306, 2, 26, 41);
+    i2c_ssd1306_queue_flush(&ssd1306);
+
+    const uint8_t expected_cmd[] = {OLED_CMD_SET_MEMORY_ADDR_MODE, 0x02, OLED_MASK_PAGE_ADDR | 2, OLED_MASK_LSB_NIBBLE_SEG_ADDR | 0x0A, OLED_MASK_HSB_NIBBLE_SEG_ADDR | 0x01};
+    int failures = 0;
+    if (mock->total_writes != 1 || !mock->writes[0].data || mock->writes[0].cmd_size != sizeof(expected_cmd) || mock->writes[0].size != 16 ||
+        memcmp(mock->bytes, expected_cmd, sizeof(expected_cmd)) != 0 || memcmp(&mock->bytes[sizeof(expected_cmd)], &ssd1306.page[2].segment[26], 16) != 0)
+    {
+        ESP_LOGE(TEST_TAG, "transfer: unexpected writes for a queued span");
+        failures++;
+    }
+    else
+    {
+        printf("PASS transfer\n");
+    }
+
+    i2c_ssd1306_deinit(&ssd1306);
+    return failures;
+}
+
+/**
+ * @brief Simulated GDDRAM of a 128x64 SSD1306
+ *
+ * The segment remap is applied when data is written, as on the SSD1306 where it only affects data written afterwards, and the
+ * COM scan direction when the panel is read.
+ */
+typedef struct
+{
+    uint8_t ram[8][128];
+    bool horizontal;
+    bool flip_segment;
+    bool flip_com;
+    uint8_t page;
+    uint8_t column;
+    uint8_t column_start;
+    uint8_t column_end;
+    uint8_t page_start;
+    uint8_t page_end;
+} panel_t;
+
+/**
+ * @brief Apply SSD1306 command bytes to the simulated panel
+ */
+static void panel_command(panel_t *panel, const uint8_t *cmd, size_t size)
+{
+    size_t i = 0;
+    while (i < size)
+    {
+        uint8_t op = cmd[i++];
+        switch (op)
+        {
+        case OLED_CMD_SET_MEMORY_ADDR_MODE:
+            panel->horizontal = cmd[i++] == 0x00;
+            break;
+        case OLED_CMD_SET_COLUMN_ADDR_RANGE:
+            panel->column_start = panel->column = cmd[i++];
+            panel->column_end = cmd[i++];
+            break;
+        case OLED_CMD_SET_PAGE_ADDR_RANGE:
+            panel->page_start = panel->page = cmd[i++];
+            panel->page_end = cmd[i++];
+            break;
+        case OLED_CMD_SEGMENT_REMAP_LEFT_TO_RIGHT:
+        case OLED_CMD_SEGMENT_REMAP_RIGHT_TO_LEFT:
+            panel->flip_segment = op == OLED_CMD_SEGMENT_REMAP_RIGHT_TO_LEFT;
+            break;
+        case OLED_CMD_COM_SCAN_DIRECTION_NORMAL:
+        case OLED_CMD_COM_SCAN_DIRECTION_REMAP:
+            panel->flip_com = op == OLED_CMD_COM_SCAN_DIRECTION_REMAP;
+            break;
+        case OLED_CMD_SET_MUX_RATIO:
+        case OLED_CMD_SET_VERT_DISPLAY_OFFSET:
+        case OLED_CMD_SET_COM_PIN_HARDWARE_MAP:
+        case OLED_CMD_SET_CONTRAST_CONTROL:
+        case OLED_CMD_SET_DISPLAY_CLK_DIVIDE:
+        case OLED_CMD_SET_PRECHARGE_PERIOD:
+        case OLED_CMD_SET_VCOMH_DESELECT_LEVEL:
+        case OLED_CMD_SET_CHARGE_PUMP:
+            i++;
+            break;
+        default:
+            if ((op & 0xF8) == OLED_MASK_PAGE_ADDR)
+                panel->page = op & 0x07;
+            else if ((op & 0xF0) == OLED_MASK_LSB_NIBBLE_SEG_ADDR)
+                panel->column = (panel->column & 0xF0) | (op & 0x0F);
+            else if ((op & 0xF0) == OLED_MASK_HSB_NIBBLE_SEG_ADDR)
+                panel->column = (panel->column & 0x0F) | (op & 0x0F) << 4;
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Write data bytes to the simulated panel at its address pointer
+ */
+static void panel_data(panel_t *panel, const uint8_t *data, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        panel->ram[panel->page][panel->flip_segment ? 127 - panel->column : panel->column] = data[i];
+        if (!panel->horizontal)
+        {
+            panel->column = (panel->column + 1) & 0x7F;
+        }
+        else if (panel->column == panel->column_end)
+        {
+            panel->column = panel->column_start;
+            panel->page = panel->page == panel->page_end ? panel->page_start : panel->page + 1;
+        }
+        else
+        {
+            panel->column++;
+        }
+    }
+}
+
+/**
+ * @brief Replay every write recorded by the mock transport on a simulated panel
+ */
+static void panel_replay(panel_t *panel, const ssd1306_mock_transport_t *mock)
+{
+    memset(panel, 0, sizeof(panel_t));
+    panel->column_end = 127;
+    panel->page_end = 7;
+    for (size_t i = 0; i < mock->total_writes; i++)
+    {
+        const ssd1306_mock_write_t *write = &mock->writes[i];
+        panel_command(panel, &mock->bytes[write->offset], write->cmd_size);
+        panel_data(panel, &mock->bytes[write->offset + write->cmd_size], write->size);
+    }
+}
+
+/**
+ * @brief Check if a pixel of the simulated panel is lit, as seen by the viewer
+ */
+static bool panel_lit(const panel_t *panel, uint8_t x, uint8_t y)
+{
+    uint8_t row = panel->flip_com ? 63 - y : y;
+    return panel->ram[row / 8][x] & (1 << (row % 8));
+}
+
+/**
+ * @brief Compare the simulated panel with the buffer of a rotated display
+ *
+ * A buffer pixel is first mirrored in the buffer, then rotated clockwise onto the 128x64 panel: by 90 degrees the top left
+ * corner of the buffer is shown at the top right corner of the panel, by 270 degrees at the bottom left corner. Differences are
+ * printed as ASCII, '+' for a pixel lit only on the panel and '-' for a pixel lit only in the buffer.
+ *
+ * @return Number of differing pixels.
+ */
+static uint16_t panel_compare(const char *name, const panel_t *panel, i2c_ssd1306_handle_t *ssd1306)
+{
+    char expected[64][128];
+    for (uint8_t y = 0; y < ssd1306->height; y++)
+    {
+        for (uint8_t x = 0; x < ssd1306->width; x++)
+        {
+            uint8_t mx = ssd1306->mirror_x ? ssd1306->width - 1 - x : x;
+            uint8_t my = ssd1306->mirror_y ? ssd1306->height - 1 - y : y;
+            uint8_t px = ssd1306->rotation == SSD1306_ROTATION_90 ? ssd1306->height - 1 - my : my;
+            uint8_t py = ssd1306->rotation == SSD1306_ROTATION_90 ? mx : ssd1306->width - 1 - mx;
+            expected[py][px] = (ssd1306->page[y / 8].segment[x] >> (y % 8)) & 1;
+        }
+    }
+
+    uint16_t differences = 0;
+    for (uint8_t y = 0; y < 64; y++)
+    {
+        for (uint8_t x = 0; x < 128; x++)
+        {
+            if (panel_lit(panel, x, y) != expected[y][x])
+                differences++;
+        }
+    }
+    if (differences == 0)
+        return 0;
+
+    ESP_LOGE(TEST_TAG, "%s: %d panel pixels differ from the rotated buffer", name, differences);
+    for (uint8_t y = 0; y < 64; y++)
+    {
+        for (uint8_t x = 0; x < 128; x++)
+        {
+            bool lit = panel_lit(panel, x, y);
+            putchar(lit == expected[y][x] ? (lit ? '#' : '.') : (lit ? '+' : '-'));
+        }
+        putchar('\n');
+    }
+    return differences;
+}
+
+/**
+ * @brief Check what reaches the panel of a display rotated by 90 and 270 degrees
+ *
+ * For each rotation and mirroring, the mock transport writes are replayed on a simulated panel after a full frame transfer and
+ * again after a queued transfer of a second drawing, and the panel must show the buffer rotated and mirrored. This covers the
+ * 8x8 transpose and the remap and COM scan pairing of i2c_ssd1306_set_orientation().
+ *
+ * @return Number of failures.
+ */
+static int check_orientation(void)
+{
+    const ssd1306_rotation_t rotations[] = {SSD1306_ROTATION_90, SSD1306_ROTATION_270};
+    int failures = 0;
+    for (uint8_t r = 0; r < 2; r++)
+    {
+        for (uint8_t mirror = 0; mirror < 4; mirror++)
+        {
+            char name[48];
+            snprintf(name, sizeof(name), "orientation %d%s%s", rotations[r] == SSD1306_ROTATION_90 ? 90 : 270,
+                     mirror & 1 ? " mirror_x" : "", mirror & 2 ? " mirror_y" : "");
+
+            i2c_ssd1306_handle_t ssd1306;
+            ssd1306_transport_t *transport;
+            ESP_ERROR_CHECK(ssd1306_transport_new_mock(&transport));
+            ESP_ERROR_CHECK(i2c_ssd1306_init_transport(&ssd1306, transport, &ssd1306_controller_ssd1306, 128, 64, SSD1306_TOP_TO_BOTTOM));
+            ESP_ERROR_CHECK(i2c_ssd1306_set_orientation(&ssd1306, rotations[r], mirror & 1, mirror & 2));
+            panel_t panel;
+
+            /* No symmetry: a glyph, a corner pixel and a bar off center. */
+            i2c_ssd1306_buffer_text(&ssd1306, 0, 0, "F", false);
+            i2c_ssd1306_buffer_fill_pixel(&ssd1306, 63, 127, true);
+            i2c_ssd1306_buffer_fill_space(&ssd1306, 10, 40, 50, 53, true);
+            i2c_ssd1306_pages_to_ram(&ssd1306);
+            panel_replay(&panel, (ssd1306_mock_transport_t *)transport);
+            uint16_t frame_differences = panel_compare(name, &panel, &ssd1306);
+
+            i2c_ssd1306_buffer_text(&ssd1306, 17, 90, "L", true);
+            i2c_ssd1306_buffer_fill_pixel(&ssd1306, 0, 127, true);
+            i2c_ssd1306_queue_space(&ssd1306, 17, 24, 90, 97);
+            i2c_ssd1306_queue_segment(&ssd1306, 15, 0);
+            i2c_ssd1306_queue_flush(&ssd1306);
+            panel_replay(&panel, (ssd1306_mock_transport_t *)transport);
+            uint16_t queue_differences = panel_compare(name, &panel, &ssd1306);
+
+            if (frame_differences != 0 || queue_differences != 0)
+            {
+                ESP_LOGE(TEST_TAG, "%s: %d pixels differ after the full frame, %d after the queued spans", name, frame_differences, queue_differences);
+                failures++;
+            }
+            else
+            {
+                printf("PASS %s\n", name);
+            }
+            i2c_ssd1306_deinit(&ssd1306);
+        }
+    }
+    return failures;
+}
+
+/**
+ * @brief Simulated 4 bits per pixel RAM of a 128x128 SSD1327
+ *
+ * Only the column and row windows are simulated. The RAM pointer moves along the rows of the window and keeps its place
+ * between writes, as on the SSD1327.
+ */
+typedef struct
+{
+    uint8_t ram[128][64];
+    uint8_t column;
+    uint8_t row;
+    uint8_t column_start;
+    uint8_t column_end;
+    uint8_t row_start;
+    uint8_t row_end;
+} gray_panel_t;
+
+/**
+ * @brief Replay the data writes recorded by the mock transport on the simulated SSD1327 RAM
+ */
+static void gray_panel_replay(gray_panel_t *panel, const ssd1306_mock_transport_t *mock)
+{
+    for (size_t w = 0; w < mock->total_writes; w++)
+    {
+        const ssd1306_mock_write_t *write = &mock->writes[w];
+        if (!write->data)
+            continue;
+
+        const uint8_t *cmd = &mock->bytes[write->offset];
+        for (size_t i = 0; i + 2 < write->cmd_size; i += 3)
+        {
+            if (cmd[i] == SSD1327_CMD_SET_COLUMN_ADDR)
+            {
+                panel->column_start = panel->column = cmd[i + 1];
+                panel->column_end = cmd[i + 2];
+            }
+            else if (cmd[i] == SSD1327_CMD_SET_ROW_ADDR)
+            {
+                panel->row_start = panel->row = cmd[i + 1];
+                panel->row_end = cmd[i + 2];
+            }
+        }
+
+        const uint8_t *data = &cmd[write->cmd_size];
+        for (size_t i = 0; i < write->size; i++)
+        {
+            panel->ram[panel->row][panel->column] = data[i];
+            if (panel->column++ == panel->column_end)
+            {
+                panel->column = panel->column_start;
+                panel->row = panel->row == panel->row_end ? panel->row_start : panel->row + 1;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Check the full frame transfer of a 4 bits per pixel controller
+ *
+ * A 128x128 SSD1327 frame goes out as a single windowed write of 8192 bytes, unrotated and rotated by 90 degrees, and leaves
+ * the RAM as the page by page transfer of the same buffer does.
+ *
+ * @return Number of failures.
+ */
+static int check_gray4(void)
+{
+    const uint8_t window_cmd[] = {SSD1327_CMD_SET_COLUMN_ADDR, 0, 63, SSD1327_CMD_SET_ROW_ADDR, 0, 127};
+    const ssd1306_rotation_t rotations[] = {SSD1306_ROTATION_0, SSD1306_ROTATION_90};
+    int failures = 0;
+    for (uint8_t r = 0; r < 2; r++)
+    {
+        const char *name = rotations[r] == SSD1306_ROTATION_0 ? "gray4 frame" : "gray4 frame 90";
+        i2c_ssd1306_handle_t ssd1306;
+        ssd1306_transport_t *transport;
+        ESP_ERROR_CHECK(ssd1306_transport_new_mock(&transport));
+        ESP_ERROR_CHECK(i2c_ssd1306_init_transport(&ssd1306, transport, &ssd1306_controller_ssd1327, 128, 128, SSD1306_TOP_TO_BOTTOM));
+        ESP_ERROR_CHECK(i2c_ssd1306_set_orientation(&ssd1306, rotations[r], false, false));
+        ssd1306_mock_transport_t *mock = (ssd1306_mock_transport_t *)transport;
+
+        i2c_ssd1306_buffer_text(&ssd1306, 3, 5, "Gray", false);
+        i2c_ssd1306_buffer_fill_pixel(&ssd1306, 5, 100, true);
+        i2c_ssd1306_buffer_fill_space(&ssd1306, 70, 120, 60, 66, true);
+
+        static gray_panel_t frame;
+        static gray_panel_t pages;
+        memset(&frame, 0, sizeof(frame));
+        memset(&pages, 0xAA, sizeof(pages));
+        ssd1306_transport_mock_clear(transport);
+        i2c_ssd1306_pages_to_ram(&ssd1306);
+        int case_failures = expect_total_writes(name, mock, 1);
+        case_failures += expect_write(name, mock, 0, true, window_cmd, sizeof(window_cmd), ssd1306.gray, 8192);
+        gray_panel_replay(&frame, mock);
+
+        ssd1306_transport_mock_clear(transport);
+        for (uint8_t i = 0; i < ssd1306.total_pages; i++)
+            i2c_ssd1306_page_to_ram(&ssd1306, i);
+        gray_panel_replay(&pages, mock);
+        if (memcmp(frame.ram, pages.ram, sizeof(frame.ram)) != 0)
+        {
+            ESP_LOGE(TEST_TAG, "%s: RAM differs from the page by page transfer", name);
+            case_failures++;
+        }
+
+        /* Unrotated, pixel (5, 100) is the high nibble of byte 2 of row 100. */
+        if (rotations[r] == SSD1306_ROTATION_0 && frame.ram[100][2] != 0xF0)
+        {
+            ESP_LOGE(TEST_TAG, "%s: pixel (5, 100) is 0x%02X in RAM, expected 0xF0", name, frame.ram[100][2]);
+            case_failures++;
+        }
+
+        if (case_failures == 0)
+            printf("PASS %s\n", name);
+        failures += case_failures;
+        i2c_ssd1306_deinit(&ssd1306);
+    }
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    bool update = argc > 1 && strcmp(argv[1], "--update") == 0;
+    bool print = argc > 1 && strcmp(argv[1], "--print") == 0;
+
+    if (update)
+        printf("#pragma once\n\n/* Generated by test_render --update. Check every frame with test_render --print before committing. */\n\n#include <stdint.h>\n\n");
+
+    int failures = 0;
+    for (size_t i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++)
+    {
+        const render_scene_t *scene = &scenes[i];
+        i2c_ssd1306_handle_t ssd1306;
+        render(scene, &ssd1306);
+
+        if (update)
+        {
+            /* Scenes sharing a golden frame are only printed once. */
+            if (i == 0 || scene->golden != scenes[i - 1].golden)
+                print_golden(scene, &ssd1306);
+        }
+        else if (print)
+        {
+            printf("%s\n", scene->name);
+            i2c_ssd1306_buffer_print(&ssd1306);
+        }
+        else if (scene->golden_size != (size_t)ssd1306.total_pages * ssd1306.width)
+        {
+            ESP_LOGE(TEST_TAG, "%s: buffer is %dx%d, golden frame has %zu bytes", scene->name, ssd1306.width, ssd1306.height, scene->golden_size);
+            failures++;
+        }
+        else if (i2c_ssd1306_buffer_compare(&ssd1306, scene->golden) != 0)
+        {
+            ESP_LOGE(TEST_TAG, "%s: differs from its golden frame", scene->name);
+            failures++;
+        }
+        else
+        {
+            printf("PASS %s\n", scene->name);
+        }
+        i2c_ssd1306_deinit(&ssd1306);
+    }
+
+    if (update || print)
+        return 0;
+
+    failures += check_transfer();
+    failures += check_orientation();
+    failures += check_gray4();
+    printf("%d failed\n", failures);
+    return failures == 0 ? 0 : 1;
+}